@@ -0,0 +1,415 @@
+/// Benchmark suite over the core libraries of all six programs.
+///   benchmark [--reps N] [--min-time SECONDS] [--filter TEXT] [--out PATH|-]
+/// Every benchmark is warmed up and calibrated once, then timed for N
+/// repetitions of the same amount of work. Results are written as JSON with
+/// the median, minimum and maximum nanoseconds per operation, so two runs can
+/// be diffed directly.
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "calculator.h"
+#include "string_utils.h"
+#include "guessing_game.h"
+#include "file_system.h"
+#include "bounded_buffer.h"
+#include "tic_tac_toe.h"
+
+// Swallows everything written to it; FileSystem reports every operation on cout
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int ch) override { return ch; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+// Redirects cout into a NullBuffer for the lifetime of the object
+class SilenceCout {
+private:
+    NullBuffer null;
+    std::streambuf* saved;
+
+public:
+    SilenceCout() : saved(std::cout.rdbuf(&null)) {}
+    ~SilenceCout() { std::cout.rdbuf(saved); }
+};
+
+struct BenchmarkResult {
+    std::string name;
+    std::uint64_t opsPerRep;
+    double medianNs;
+    double minNs;
+    double maxNs;
+};
+
+class BenchmarkSuite {
+private:
+    int repetitions;
+    double minRepSeconds;
+    std::string filter;
+    std::vector<BenchmarkResult> results;
+    volatile double sink = 0;
+
+    static double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    template <typename Body>
+    double timeBatches(Body& body, std::uint64_t batches) {
+        double sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t b = 0; b < batches; b++) {
+            sum += body();
+        }
+        double seconds = secondsSince(start);
+        sink = sink + sum;
+        return seconds;
+    }
+
+public:
+    BenchmarkSuite(int repetitions, double minRepSeconds, const std::string& filter)
+        : repetitions(repetitions), minRepSeconds(minRepSeconds), filter(filter) {}
+
+    bool selected(const std::string& name) const {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    // body() performs opsPerBatch operations and returns a value that keeps
+    // the work observable. The batch count per repetition is calibrated once
+    // so that a repetition lasts at least minRepSeconds.
+    template <typename Body>
+    void run(const std::string& name, std::uint64_t opsPerBatch, Body body) {
+        if (!selected(name)) return;
+
+        std::uint64_t batches = 1;
+        for (;;) {
+            double seconds = timeBatches(body, batches);
+            if (seconds >= minRepSeconds) break;
+            double scale = (seconds > 0) ? minRepSeconds / seconds * 1.2 : 16.0;
+            batches = std::max<std::uint64_t>(batches * 2, static_cast<std::uint64_t>(batches * std::min(scale, 16.0)));
+        }
+
+        std::vector<double> nsPerOp;
+        std::uint64_t ops = batches * opsPerBatch;
+        for (int r = 0; r < repetitions; r++) {
+            nsPerOp.push_back(timeBatches(body, batches) * 1e9 / static_cast<double>(ops));
+        }
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+        std::size_t mid = nsPerOp.size() / 2;
+        double median = (nsPerOp.size() % 2 == 1) ? nsPerOp[mid] : (nsPerOp[mid - 1] + nsPerOp[mid]) / 2;
+
+        results.push_back({name, ops, median, nsPerOp.front(), nsPerOp.back()});
+        std::cerr << name << ": " << median << " ns/op" << std::endl;
+    }
+
+    bool writeJson(std::FILE* output) const {
+        std::fprintf(output, "{\n  \"schema\": 1,\n");
+#ifdef __VERSION__
+        std::fprintf(output, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+        std::fprintf(output, "  \"string_kernels\": \"%s\",\n", stringKernels().name);
+#ifdef METRICS_DISABLED
+        std::fprintf(output, "  \"metrics\": false,\n");
+#else
+        std::fprintf(output, "  \"metrics\": true,\n");
+#endif
+        std::fprintf(output, "  \"repetitions\": %d,\n", repetitions);
+        std::fprintf(output, "  \"benchmarks\": [");
+        for (std::size_t i = 0; i < results.size(); i++) {
+            const BenchmarkResult& r = results[i];
+            std::fprintf(output,
+                         "%s\n    {\"name\": \"%s\", \"ops_per_rep\": %llu, \"median_ns\": %.3f, "
+                         "\"min_ns\": %.3f, \"max_ns\": %.3f}",
+                         i == 0 ? "" : ",", r.name.c_str(), static_cast<unsigned long long>(r.opsPerRep), r.medianNs,
+                         r.minNs, r.maxNs);
+        }
+        std::fprintf(output, "\n  ]\n}\n");
+        return std::ferror(output) == 0;
+    }
+};
+
+// Calculator: single operations through each error-reporting style, the
+// compiled expression and the batch kernels
+static void benchCalculator(BenchmarkSuite& suite) {
+    const std::size_t N = 4096;
+    std::vector<double> a(N), b(N), result(N);
+    std::vector<std::uint8_t> errors(N);
+    for (std::size_t i = 0; i < N; i++) {
+        a[i] = static_cast<double>(i % 1000) + 0.5;
+        b[i] = static_cast<double>(i % 97 + 1);
+    }
+
+    suite.run("calculator/basic_operation", N, [&]() {
+        double sum = 0;
+        for (std::size_t i = 0; i < N; i++) sum += BasicOperation(a[i], '/', b[i]).result;
+        return sum;
+    });
+    suite.run("calculator/basic_operation_error", 256, [&]() {
+        double failed = 0;
+        for (std::size_t i = 0; i < 256; i++) {
+            try {
+                failed += BasicOperation(a[i], '/', 0.0).result;
+            } catch (const std::runtime_error&) {
+                failed++;
+            }
+        }
+        return failed;
+    });
+    suite.run("calculator/calculate", N, [&]() {
+        double sum = 0;
+        for (std::size_t i = 0; i < N; i++) sum += calculate(a[i], '/', b[i]).value;
+        return sum;
+    });
+    suite.run("calculator/calculate_specialized", N, [&]() {
+        double sum = 0;
+        for (std::size_t i = 0; i < N; i++) sum += calculate<'/'>(a[i], b[i]).value;
+        return sum;
+    });
+
+    Expression expr("(a+b)*a/b");
+    suite.run("calculator/expression_evaluate", N, [&]() {
+        double sum = 0;
+        double values[2];
+        for (std::size_t i = 0; i < N; i++) {
+            values[0] = a[i];
+            values[1] = b[i];
+            sum += expr.evaluate(values).value;
+        }
+        return sum;
+    });
+
+    const double* columns[] = {a.data(), b.data()};
+    suite.run("calculator/expression_batch", N, [&]() {
+        return static_cast<double>(expr.evaluateBatch(columns, result.data(), errors.data(), N)) + result[N - 1];
+    });
+    suite.run("calculator/evaluate_batch", N, [&]() {
+        return static_cast<double>(evaluateBatch('/', a.data(), b.data(), result.data(), errors.data(), N)) +
+               result[N - 1];
+    });
+}
+
+// String kernels on a short and a long buffer, through the dispatched API;
+// one operation is one call over the whole buffer
+static void benchStrings(BenchmarkSuite& suite) {
+    const std::size_t sizes[] = {64, 65536};
+    for (std::size_t size : sizes) {
+        // Palindromic ASCII so the compare walks the whole buffer
+        std::vector<char> data(size);
+        FastRandom rng(size);
+        for (std::size_t i = 0; i < size / 2; i++) {
+            char ch = static_cast<char>('A' + rng.between(0, 57));
+            data[i] = ch;
+            data[size - 1 - i] = ch;
+        }
+        std::string_view view(data.data(), size);
+        std::string suffix = "_" + std::to_string(size);
+
+        suite.run("strings/reverse" + suffix, 1, [&]() {
+            reverseString(data.data(), size);
+            return static_cast<double>(data[0]);
+        });
+        suite.run("strings/count_vowels" + suffix, 1, [&]() {
+            return static_cast<double>(countingVowels(view));
+        });
+        suite.run("strings/is_palindrome" + suffix, 1, [&]() {
+            return static_cast<double>(isPalindrome(view));
+        });
+        suite.run("strings/count_vowels_utf8" + suffix, 1, [&]() {
+            return static_cast<double>(countingVowelsUtf8(view));
+        });
+
+        PalindromeOptions loose;
+        loose.foldCase = true;
+        loose.skipPunctuation = true;
+        suite.run("strings/is_palindrome_utf8_loose" + suffix, 1, [&]() {
+            return static_cast<double>(isPalindromeUtf8(view, loose));
+        });
+    }
+}
+
+// Number guessing: whole games per strategy on the default 1-100 range and a wide one
+static void benchGuessing(BenchmarkSuite& suite) {
+    const char* strategies[] = {"binary", "random", "interpolation"};
+    for (const char* strategy : strategies) {
+        std::unique_ptr<Guesser> guesser = makeGuesser(strategy, 42);
+        FastRandom rng(7);
+        suite.run(std::string("guessing/play_game_") + strategy, 1024, [&]() {
+            double attempts = 0;
+            for (int g = 0; g < 1024; g++) {
+                attempts += playGame(*guesser, rng.between(1, 1000000), 1, 1000000, 1000);
+            }
+            return attempts;
+        });
+    }
+}
+
+// File system: lookups in a full table, and create/write/delete round trips
+// against real files in a scratch directory. cout is silenced while they run.
+static void benchFileSystem(BenchmarkSuite& suite) {
+    char dir[] = "/tmp/bench-fs-XXXXXX";
+    if (mkdtemp(dir) == nullptr) {
+        std::cerr << "Error: Could not create a scratch directory, skipping file_system benchmarks" << std::endl;
+        return;
+    }
+    std::vector<std::string> names;
+    for (int i = 0; i < MAX_FILES; i++) {
+        names.push_back(std::string(dir) + "/f" + std::to_string(i));
+    }
+
+    {
+        SilenceCout silence;
+        FileSystem fs;
+        for (const std::string& name : names) fs.createFile(name.c_str(), "benchmark");
+
+        suite.run("file_system/find_file", MAX_FILES, [&]() {
+            double sum = 0;
+            for (const std::string& name : names) sum += fs.findFile(name.c_str());
+            return sum;
+        });
+        suite.run("file_system/find_file_missing", 1, [&]() {
+            return static_cast<double>(fs.findFile("missing"));
+        });
+        suite.run("file_system/write_file", 1, [&]() {
+            return static_cast<double>(fs.writeFile(names[0].c_str(), "overwritten", false));
+        });
+        for (const std::string& name : names) fs.deleteFile(name.c_str());
+
+        suite.run("file_system/create_delete", 16, [&]() {
+            double ok = 0;
+            for (int i = 0; i < 16; i++) ok += fs.createFile(names[i].c_str(), "benchmark");
+            for (int i = 0; i < 16; i++) ok += fs.deleteFile(names[i].c_str());
+            return ok;
+        });
+    }
+    rmdir(dir);
+}
+
+// Producer-consumer buffer: uncontended put/take pairs, then one producer
+// thread feeding the main thread through a small buffer
+static void benchBoundedBuffer(BenchmarkSuite& suite) {
+    const int CAPACITY = 64;
+    BoundedBuffer uncontended(CAPACITY);
+    suite.run("bounded_buffer/put_take", CAPACITY, [&]() {
+        double sum = 0;
+        int item;
+        for (int i = 0; i < CAPACITY; i++) uncontended.put(i, 1);
+        for (int i = 0; i < CAPACITY; i++) {
+            uncontended.take(item, 1);
+            sum += item;
+        }
+        return sum;
+    });
+
+    const int ITEMS = 4096;
+    suite.run("bounded_buffer/producer_consumer", ITEMS, [&]() {
+        BoundedBuffer buffer(CAPACITY);
+        std::thread producer([&buffer]() {
+            for (int i = 0; i < ITEMS; i++) buffer.put(i, 1);
+            buffer.close();
+        });
+        double sum = 0;
+        int item;
+        while (buffer.take(item, 1)) sum += item;
+        producer.join();
+        return sum;
+    });
+}
+
+// Tic-Tac-Toe: win/draw checks over a set of random positions, and full games
+static void benchTicTacToe(BenchmarkSuite& suite) {
+    struct Position {
+        char board[BOARD_SIZE][BOARD_SIZE];
+    };
+    const int BOARDS = 1024;
+    std::vector<Position> positions(BOARDS);
+    FastRandom rng(3);
+    const char marks[] = {EMPTY, PLAYER_X, PLAYER_O};
+    for (Position& position : positions) {
+        for (int i = 0; i < BOARD_SIZE; i++) {
+            for (int j = 0; j < BOARD_SIZE; j++) position.board[i][j] = marks[rng.between(0, 2)];
+        }
+    }
+
+    suite.run("tic_tac_toe/check_win", BOARDS, [&]() {
+        double wins = 0;
+        for (int i = 0; i < BOARDS; i++) wins += checkWin(positions[i].board, PLAYER_X);
+        return wins;
+    });
+    suite.run("tic_tac_toe/check_draw", BOARDS, [&]() {
+        double draws = 0;
+        for (int i = 0; i < BOARDS; i++) draws += checkDraw(positions[i].board);
+        return draws;
+    });
+
+    // Fills the board in a fixed order, checking after every move as the game loop does
+    const int order[BOARD_SIZE * BOARD_SIZE] = {4, 0, 8, 2, 6, 3, 5, 1, 7};
+    suite.run("tic_tac_toe/play_game", 1, [&]() {
+        char board[BOARD_SIZE][BOARD_SIZE];
+        initializeBoard(board);
+        char player = PLAYER_X;
+        int moves = 0;
+        for (int cell : order) {
+            makeMove(board, cell / BOARD_SIZE, cell % BOARD_SIZE, player);
+            moves++;
+            if (checkWin(board, player) || checkDraw(board)) break;
+            player = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+        }
+        return static_cast<double>(moves);
+    });
+}
+
+int main(int argc, char* argv[]) {
+    int repetitions = 15;
+    double minRepSeconds = 0.01;
+    std::string filter;
+    const char* outputPath = "-";
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--reps") == 0 && hasValue) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && hasValue) {
+            minRepSeconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--out") == 0 && hasValue) {
+            outputPath = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--reps N] [--min-time SECONDS] [--filter TEXT] [--out PATH|-]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    BenchmarkSuite suite(repetitions, minRepSeconds, filter);
+    benchCalculator(suite);
+    benchStrings(suite);
+    benchGuessing(suite);
+    benchFileSystem(suite);
+    benchBoundedBuffer(suite);
+    benchTicTacToe(suite);
+
+    std::FILE* output = (std::strcmp(outputPath, "-") == 0) ? stdout : std::fopen(outputPath, "w");
+    if (output == nullptr) {
+        std::cerr << "Error: Could not open '" << outputPath << "' for writing!" << std::endl;
+        return 1;
+    }
+    bool written = suite.writeJson(output);
+    written = (output == stdout ? std::fflush(output) : std::fclose(output)) == 0 && written;
+    if (!written) {
+        std::cerr << "Error: Could not write results!" << std::endl;
+        return 1;
+    }
+    return 0;
+}
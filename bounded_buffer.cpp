@@ -0,0 +1,137 @@
+// Producer-consumer core: a fixed-capacity ring buffer guarded by a pthread
+// mutex and two condition variables
+#include "bounded_buffer.h"
+#include <iostream>
+#include "metrics.h"
+using namespace std;
+
+// Put/take latencies include any time spent waiting for room or for an item
+METRICS_HISTOGRAM(putLatency, "bounded_buffer.put");
+METRICS_HISTOGRAM(takeLatency, "bounded_buffer.take");
+METRICS_COUNTER(itemsPut, "bounded_buffer.items_put");
+METRICS_COUNTER(itemsTaken, "bounded_buffer.items_taken");
+METRICS_COUNTER(fullWaits, "bounded_buffer.full_waits");
+METRICS_COUNTER(emptyWaits, "bounded_buffer.empty_waits");
+
+BoundedBuffer::BoundedBuffer(int capacity, bool verbose)
+    : items(capacity > 0 ? capacity : 1), count(0), in(0), out(0), producedTotal(0), consumedTotal(0),
+      closed(false), verbose(verbose) {
+    pthread_mutex_init(&mutex, nullptr);
+    pthread_cond_init(&notFull, nullptr);
+    pthread_cond_init(&notEmpty, nullptr);
+}
+
+BoundedBuffer::~BoundedBuffer() {
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&notFull);
+    pthread_cond_destroy(&notEmpty);
+}
+
+// Function to display buffer state (for debugging/visualization)
+void BoundedBuffer::display() const {
+    int size = capacity();
+    cout << "Buffer [";
+    for (int i = 0; i < size; i++) {
+        if (i < count) {
+            cout << items[(out + i) % size];
+        } else {
+            cout << "_";
+        }
+        if (i < size - 1) cout << " ";
+    }
+    cout << "] Count: " << count << "/" << size << endl;
+}
+
+void BoundedBuffer::put(int item, int producerId) {
+    METRICS_TIME(putLatency);
+
+    // Lock the mutex before accessing shared resources
+    pthread_mutex_lock(&mutex);
+
+    // Wait while buffer is full
+    while (count == capacity()) {
+        METRICS_INC(fullWaits);
+        if (verbose) cout << "Producer " << producerId << " waiting (buffer full)..." << endl;
+        pthread_cond_wait(&notFull, &mutex);
+    }
+
+    // Add item to buffer
+    items[in] = item;
+    in = (in + 1) % capacity();
+    count++;
+    producedTotal++;
+    METRICS_INC(itemsPut);
+
+    if (verbose) {
+        cout << ">>> Producer " << producerId << " produced item: " << item
+             << " (Total produced: " << producedTotal << ")" << endl;
+        display();
+    }
+
+    // Signal that buffer is not empty
+    pthread_cond_signal(&notEmpty);
+    pthread_mutex_unlock(&mutex);
+}
+
+bool BoundedBuffer::take(int& item, int consumerId) {
+    METRICS_TIME(takeLatency);
+
+    pthread_mutex_lock(&mutex);
+
+    // Wait while buffer is empty, unless production is done
+    while (count == 0) {
+        if (closed) {
+            pthread_mutex_unlock(&mutex);
+            return false;
+        }
+        METRICS_INC(emptyWaits);
+        if (verbose) cout << "Consumer " << consumerId << " waiting (buffer empty)..." << endl;
+        pthread_cond_wait(&notEmpty, &mutex);
+    }
+
+    // Remove item from buffer
+    item = items[out];
+    out = (out + 1) % capacity();
+    count--;
+    consumedTotal++;
+    METRICS_INC(itemsTaken);
+
+    if (verbose) {
+        cout << "<<< Consumer " << consumerId << " consumed item: " << item
+             << " (Total consumed: " << consumedTotal << ")" << endl;
+        display();
+    }
+
+    // Signal that buffer is not full
+    pthread_cond_signal(&notFull);
+    pthread_mutex_unlock(&mutex);
+    return true;
+}
+
+void BoundedBuffer::close() {
+    pthread_mutex_lock(&mutex);
+    closed = true;
+    pthread_cond_broadcast(&notEmpty); // Wake up all waiting consumers
+    pthread_mutex_unlock(&mutex);
+}
+
+int BoundedBuffer::size() const {
+    pthread_mutex_lock(&mutex);
+    int result = count;
+    pthread_mutex_unlock(&mutex);
+    return result;
+}
+
+int BoundedBuffer::produced() const {
+    pthread_mutex_lock(&mutex);
+    int result = producedTotal;
+    pthread_mutex_unlock(&mutex);
+    return result;
+}
+
+int BoundedBuffer::consumed() const {
+    pthread_mutex_lock(&mutex);
+    int result = consumedTotal;
+    pthread_mutex_unlock(&mutex);
+    return result;
+}
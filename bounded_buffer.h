@@ -0,0 +1,50 @@
+// Producer-consumer core: a fixed-capacity ring buffer guarded by a pthread
+// mutex and two condition variables
+#ifndef BOUNDED_BUFFER_H
+#define BOUNDED_BUFFER_H
+
+#include <pthread.h>
+#include <vector>
+
+class BoundedBuffer {
+private:
+    std::vector<int> items;
+    int count;           // Current items in buffer
+    int in;              // Producer index
+    int out;             // Consumer index
+    int producedTotal;   // Total items produced
+    int consumedTotal;   // Total items consumed
+    bool closed;         // No more items will be put
+    bool verbose;        // Log every put/take and the buffer state
+
+    mutable pthread_mutex_t mutex;
+    pthread_cond_t notFull;
+    pthread_cond_t notEmpty;
+
+    // Prints the buffer state; called with the mutex held
+    void display() const;
+
+public:
+    explicit BoundedBuffer(int capacity, bool verbose = false);
+    ~BoundedBuffer();
+
+    BoundedBuffer(const BoundedBuffer&) = delete;
+    BoundedBuffer& operator=(const BoundedBuffer&) = delete;
+
+    // Adds an item, waiting while the buffer is full
+    void put(int item, int producerId);
+
+    // Removes the oldest item, waiting while the buffer is empty. Returns false
+    // once the buffer has been closed and drained.
+    bool take(int& item, int consumerId);
+
+    // Marks production as done and wakes every waiting consumer
+    void close();
+
+    int capacity() const { return static_cast<int>(items.size()); }
+    int size() const;
+    int produced() const;
+    int consumed() const;
+};
+
+#endif
@@ -0,0 +1,493 @@
+/// <task1: Basic Calculator> core, see calculator.h
+#include "calculator.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define BATCH_KERNELS_X86 1
+#endif
+
+/// @brief Batch kernels over structure-of-arrays columns: out[i] = a[i] op b[i],
+/// with op one of + - * / or '~' for unary minus (b unused; pass a, since the
+/// vector kernels still offset it for the tail). A zero divisor gives
+/// NaN and ORs BATCH_DIVISION_BY_ZERO into errors[i] instead of throwing.
+static void applyBatchScalar(char op, const double* a, const double* b, double* out, std::uint8_t* errors,
+                             std::size_t n) {
+    switch (op) {
+        case '+': for (std::size_t i = 0; i < n; i++) out[i] = a[i] + b[i]; break;
+        case '-': for (std::size_t i = 0; i < n; i++) out[i] = a[i] - b[i]; break;
+        case '*': for (std::size_t i = 0; i < n; i++) out[i] = a[i] * b[i]; break;
+        case '~': for (std::size_t i = 0; i < n; i++) out[i] = -a[i]; break;
+        case '/':
+            for (std::size_t i = 0; i < n; i++) {
+                if (b[i] != 0) {
+                    out[i] = a[i] / b[i];
+                } else {
+                    out[i] = std::numeric_limits<double>::quiet_NaN();
+                    errors[i] |= BATCH_DIVISION_BY_ZERO;
+                }
+            }
+            break;
+    }
+}
+
+#ifdef BATCH_KERNELS_X86
+__attribute__((target("avx2")))
+static void applyBatchAVX2(char op, const double* a, const double* b, double* out, std::uint8_t* errors,
+                           std::size_t n) {
+    std::size_t i = 0;
+    switch (op) {
+        case '+':
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+        case '-':
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+        case '*':
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+            break;
+        case '~':
+            for (; i + 4 <= n; i += 4) _mm256_storeu_pd(out + i, _mm256_xor_pd(_mm256_loadu_pd(a + i), _mm256_set1_pd(-0.0)));
+            break;
+        case '/': {
+            const __m256d nan = _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN());
+            for (; i + 4 <= n; i += 4) {
+                __m256d divisor = _mm256_loadu_pd(b + i);
+                __m256d zero = _mm256_cmp_pd(divisor, _mm256_setzero_pd(), _CMP_EQ_OQ);
+                __m256d quotient = _mm256_div_pd(_mm256_loadu_pd(a + i), divisor);
+                _mm256_storeu_pd(out + i, _mm256_blendv_pd(quotient, nan, zero));
+                int mask = _mm256_movemask_pd(zero);
+                for (int k = 0; mask != 0; k++, mask >>= 1) errors[i + k] |= (mask & 1) ? BATCH_DIVISION_BY_ZERO : 0;
+            }
+            break;
+        }
+    }
+    // The scalar tail is legacy-SSE encoded; clear the upper vector state first
+    // so it doesn't pay the AVX-to-SSE transition penalty
+    _mm256_zeroupper();
+    applyBatchScalar(op, a + i, b + i, out + i, errors + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+static void applyBatchAVX512(char op, const double* a, const double* b, double* out, std::uint8_t* errors,
+                             std::size_t n) {
+    std::size_t i = 0;
+    switch (op) {
+        case '+':
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_add_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+        case '-':
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+        case '*':
+            for (; i + 8 <= n; i += 8) _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+            break;
+        case '~': {
+            // Flip the sign bit (AVX512F has no double xor, so go through the integer view)
+            const __m512i sign = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL));
+            for (; i + 8 <= n; i += 8) {
+                _mm512_storeu_pd(out + i, _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_mm512_loadu_pd(a + i)), sign)));
+            }
+            break;
+        }
+        case '/': {
+            const __m512d nan = _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN());
+            for (; i + 8 <= n; i += 8) {
+                __m512d divisor = _mm512_loadu_pd(b + i);
+                __mmask8 zero = _mm512_cmp_pd_mask(divisor, _mm512_setzero_pd(), _CMP_EQ_OQ);
+                __m512d quotient = _mm512_div_pd(_mm512_loadu_pd(a + i), divisor);
+                _mm512_storeu_pd(out + i, _mm512_mask_blend_pd(zero, quotient, nan));
+                unsigned mask = zero;
+                for (int k = 0; mask != 0; k++, mask >>= 1) errors[i + k] |= (mask & 1) ? BATCH_DIVISION_BY_ZERO : 0;
+            }
+            break;
+        }
+    }
+    _mm256_zeroupper();
+    applyBatchScalar(op, a + i, b + i, out + i, errors + i, n - i);
+}
+#endif
+
+typedef void (*BatchKernel)(char op, const double* a, const double* b, double* out, std::uint8_t* errors,
+                            std::size_t n);
+
+// Picked once at startup from the CPU's feature flags
+static BatchKernel selectBatchKernel() {
+#ifdef BATCH_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return applyBatchAVX512;
+    if (__builtin_cpu_supports("avx2")) return applyBatchAVX2;
+#endif
+    return applyBatchScalar;
+}
+
+// Selected on first use, so callers in other translation units' static
+// initializers still see a valid kernel
+static BatchKernel batchKernel() {
+    static const BatchKernel kernel = selectBatchKernel();
+    return kernel;
+}
+
+static std::size_t countErrors(const std::uint8_t* errors, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; i++) count += errors[i] != 0;
+    return count;
+}
+
+// Splits [0, n) into one contiguous chunk per hardware thread once n is
+// large enough to pay for the threads, and calls work(begin, end) on each
+template <typename Work>
+static void forEachChunk(std::size_t n, Work work) {
+    const std::size_t minPerThread = std::size_t(1) << 16;
+    if (n < 2 * minPerThread) {
+        work(std::size_t(0), n);
+        return;
+    }
+
+    // hardware_concurrency() reads sysfs on every call, so ask only once
+    static const std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t threadCount = std::min(hardwareThreads, n / minPerThread);
+    if (threadCount == 1) {
+        work(std::size_t(0), n);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    std::size_t chunk = n / threadCount;
+    for (std::size_t t = 0; t < threadCount; t++) {
+        std::size_t begin = t * chunk;
+        std::size_t end = (t + 1 == threadCount) ? n : begin + chunk;
+        workers.emplace_back(work, begin, end);
+    }
+    for (std::thread& worker : workers) worker.join();
+}
+
+std::size_t evaluateBatch(char op, const double* arg1, const double* arg2, double* result, std::uint8_t* errors,
+                          std::size_t n) {
+    if (op != '+' && op != '-' && op != '*' && op != '/') {
+        throw std::runtime_error("Invalid operator");
+    }
+
+    std::memset(errors, 0, n);
+    BatchKernel applyBatch = batchKernel();
+    forEachChunk(n, [=](std::size_t begin, std::size_t end) {
+        applyBatch(op, arg1 + begin, arg2 + begin, result + begin, errors + begin, end - begin);
+    });
+    return op == '/' ? countErrors(errors, n) : 0;
+}
+
+Expression::Expression(const std::string& source) : source(source), pos(0), depth(0), maxDepth(0), nesting(0) {
+    parseSum();
+    skipSpaces();
+    if (pos != source.size()) {
+        fail("Unexpected character");
+    }
+}
+
+int Expression::variableIndex(const std::string& name) const {
+    for (std::size_t i = 0; i < names.size(); i++) {
+        if (names[i] == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+std::size_t Expression::evaluateBatch(const double* const* columns, double* result, std::uint8_t* errors, std::size_t n) const {
+    std::memset(errors, 0, n);
+    forEachChunk(n, [=](std::size_t begin, std::size_t end) {
+        std::vector<double> scratch(maxDepth * BATCH_BLOCK);
+        for (std::size_t pos = begin; pos < end; pos += BATCH_BLOCK) {
+            evaluateBlock(columns, pos, std::min(BATCH_BLOCK, end - pos), scratch.data(), result + pos,
+                          errors + pos);
+        }
+    });
+    return countErrors(errors, n);
+}
+
+// Stack slot k lives in scratch[k * BATCH_BLOCK]; variables are read in place
+void Expression::evaluateBlock(const double* const* columns, std::size_t offset, std::size_t n, double* scratch,
+                   double* result, std::uint8_t* errors) const {
+    const double* stack[MAX_STACK];
+    std::size_t top = 0;
+    BatchKernel applyBatch = batchKernel();
+
+    for (const Instruction& ins : program) {
+        double* slot = scratch + (top == 0 ? 0 : top - 1) * BATCH_BLOCK;
+        switch (ins.code) {
+            case PUSH_CONST:
+                slot = scratch + top * BATCH_BLOCK;
+                std::fill(slot, slot + n, constants[ins.operand]);
+                stack[top++] = slot;
+                break;
+            case PUSH_VAR: stack[top++] = columns[ins.operand] + offset; break;
+            case NEG: applyBatch('~', stack[top - 1], stack[top - 1], slot, errors, n); stack[top - 1] = slot; break;
+            default:
+                top--;
+                slot = scratch + (top - 1) * BATCH_BLOCK;
+                applyBatch(OP_CHARS[ins.code], stack[top - 1], stack[top], slot, errors, n);
+                stack[top - 1] = slot;
+                break;
+        }
+    }
+    std::copy(stack[0], stack[0] + n, result);
+}
+
+// Quotes at most CONTEXT characters on each side of the error, so a huge
+// input doesn't make a huge message
+void Expression::fail(const char* message) const {
+    const std::size_t CONTEXT = 32;
+    std::size_t from = (pos > CONTEXT) ? pos - CONTEXT : 0;
+    std::size_t to = std::min(source.size(), pos + CONTEXT);
+    std::string excerpt = (from > 0 ? "..." : "") + source.substr(from, to - from) + (to < source.size() ? "..." : "");
+    throw std::runtime_error(std::string(message) + " at position " + std::to_string(pos) + " in \"" + excerpt + "\"");
+}
+
+void Expression::skipSpaces() {
+    while (pos < source.size() && std::isspace(static_cast<unsigned char>(source[pos]))) pos++;
+}
+
+void Expression::push(OpCode code, std::uint32_t operand) {
+    program.push_back({code, operand});
+    if (++depth > maxDepth) {
+        maxDepth = depth;
+        if (maxDepth > MAX_STACK) fail("Expression too deeply nested");
+    }
+}
+
+// Parentheses and unary signs recurse without pushing values, so they need
+// their own limit to keep hostile input from overflowing the call stack
+void Expression::enterNested() {
+    if (++nesting > MAX_NESTING) fail("Expression too deeply nested");
+}
+
+// Emits a binary operator, folding it when both operands are constants
+void Expression::emitBinary(OpCode code) {
+    std::size_t n = program.size();
+    if (program[n - 2].code == PUSH_CONST && program[n - 1].code == PUSH_CONST) {
+        double a = constants[program[n - 2].operand];
+        double b = constants[program[n - 1].operand];
+        if (code != DIV || b != 0) {
+            double folded = (code == ADD) ? a + b : (code == SUB) ? a - b : (code == MUL) ? a * b : a / b;
+            constants.pop_back();
+            constants.back() = folded;
+            program.pop_back();
+            depth--;
+            return;
+        }
+    }
+    program.push_back({code, 0});
+    depth--;
+}
+
+void Expression::parseSum() {
+    parseProduct();
+    for (;;) {
+        skipSpaces();
+        if (pos >= source.size() || (source[pos] != '+' && source[pos] != '-')) return;
+        OpCode code = (source[pos++] == '+') ? ADD : SUB;
+        parseProduct();
+        emitBinary(code);
+    }
+}
+
+void Expression::parseProduct() {
+    parseUnary();
+    for (;;) {
+        skipSpaces();
+        if (pos >= source.size() || (source[pos] != '*' && source[pos] != '/')) return;
+        OpCode code = (source[pos++] == '*') ? MUL : DIV;
+        parseUnary();
+        emitBinary(code);
+    }
+}
+
+void Expression::parseUnary() {
+    skipSpaces();
+    if (pos < source.size() && (source[pos] == '-' || source[pos] == '+')) {
+        bool negate = source[pos++] == '-';
+        enterNested();
+        parseUnary();
+        nesting--;
+        if (!negate) return;
+        if (program.back().code == PUSH_CONST) {
+            constants[program.back().operand] = -constants[program.back().operand];
+        } else {
+            program.push_back({NEG, 0});
+        }
+        return;
+    }
+    parsePrimary();
+}
+
+void Expression::parsePrimary() {
+    skipSpaces();
+    if (pos >= source.size()) {
+        fail("Unexpected end of expression");
+    }
+
+    char ch = source[pos];
+    if (ch == '(') {
+        pos++;
+        enterNested();
+        parseSum();
+        nesting--;
+        skipSpaces();
+        if (pos >= source.size() || source[pos] != ')') {
+            fail("Missing ')'");
+        }
+        pos++;
+    } else if (std::isdigit(static_cast<unsigned char>(ch)) || ch == '.') {
+        const char* start = source.c_str() + pos;
+        char* end = nullptr;
+        double value = std::strtod(start, &end);
+        if (end == start) {
+            fail("Invalid number");
+        }
+        pos += static_cast<std::size_t>(end - start);
+        constants.push_back(value);
+        push(PUSH_CONST, static_cast<std::uint32_t>(constants.size() - 1));
+    } else if (std::isalpha(static_cast<unsigned char>(ch)) || ch == '_') {
+        std::size_t start = pos;
+        while (pos < source.size() && (std::isalnum(static_cast<unsigned char>(source[pos])) || source[pos] == '_')) {
+            pos++;
+        }
+        std::string name = source.substr(start, pos - start);
+        int slot = variableIndex(name);
+        if (slot < 0) {
+            names.push_back(name);
+            slot = static_cast<int>(names.size() - 1);
+        }
+        push(PUSH_VAR, static_cast<std::uint32_t>(slot));
+    } else {
+        fail("Unexpected character");
+    }
+}
+
+StreamCalculator::StreamCalculator(std::FILE* output) : output(output), count(0), lines(0), used(0),
+    arg1(BATCH_SIZE), arg2(BATCH_SIZE), result(BATCH_SIZE), ops(BATCH_SIZE), errors(BATCH_SIZE), outBuffer(OUT_FLUSH_AT + 64) {}
+
+bool StreamCalculator::run(std::FILE* input) {
+    std::vector<char> buffer(READ_CHUNK);
+    std::size_t carry = 0;
+
+    for (;;) {
+        std::size_t got = std::fread(buffer.data() + carry, 1, buffer.size() - carry, input);
+        const char* pos = buffer.data();
+        const char* end = pos + carry + got;
+
+        const char* newline;
+        while ((newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(end - pos)))) != nullptr) {
+            addLine(pos, newline);
+            pos = newline + 1;
+        }
+        carry = static_cast<std::size_t>(end - pos);
+
+        if (got == 0) {
+            if (carry > 0) addLine(pos, end);
+            break;
+        }
+        std::memmove(buffer.data(), pos, carry);
+        if (carry == buffer.size()) buffer.resize(buffer.size() * 2); // a line longer than the buffer
+    }
+
+    evaluatePending();
+    return !std::ferror(input) && flushOutput();
+}
+
+const char* StreamCalculator::skipSeparators(const char* pos, const char* end) {
+    while (pos < end && (*pos == ' ' || *pos == '\t' || *pos == ',' || *pos == '\r')) pos++;
+    return pos;
+}
+
+// Parses a number the way operator>> does: an optional sign, then digits or
+// a '.', so a leading '+' is accepted and "inf"/"nan" are not
+static std::from_chars_result parseNumber(const char* pos, const char* end, double& value) {
+    const char* digits = pos;
+    if (digits < end && (*digits == '+' || *digits == '-')) digits++;
+    if (digits == end || !(std::isdigit(static_cast<unsigned char>(*digits)) || *digits == '.')) {
+        return {pos, std::errc::invalid_argument};
+    }
+    return std::from_chars(*pos == '+' ? digits : pos, end, value); // from_chars rejects '+'
+}
+
+void StreamCalculator::addLine(const char* pos, const char* end) {
+    pos = skipSeparators(pos, end);
+    if (pos == end) return;
+
+    double a = 0, b = 0;
+    char op = 0;
+    std::uint8_t error = 0;
+
+    std::from_chars_result parsed = parseNumber(pos, end, a);
+    if (parsed.ec != std::errc()) {
+        error = BATCH_INVALID_INPUT;
+    } else {
+        pos = skipSeparators(parsed.ptr, end);
+        if (pos < end) op = *pos++;
+        pos = skipSeparators(pos, end);
+        parsed = parseNumber(pos, end, b);
+        if (parsed.ec != std::errc() || skipSeparators(parsed.ptr, end) != end) {
+            error = BATCH_INVALID_INPUT;
+        }
+    }
+
+    arg1[count] = a;
+    arg2[count] = b;
+    ops[count] = op;
+    errors[count] = error;
+    if (++count == BATCH_SIZE) evaluatePending();
+}
+
+// Runs of lines with the same operator go through the vector kernel together
+void StreamCalculator::evaluatePending() {
+    BatchKernel applyBatch = batchKernel();
+    std::size_t start = 0;
+    while (start < count) {
+        char op = ops[start];
+        std::size_t end = start + 1;
+        while (end < count && ops[end] == op) end++;
+
+        if (op == '+' || op == '-' || op == '*' || op == '/') {
+            applyBatch(op, &arg1[start], &arg2[start], &result[start], &errors[start], end - start);
+        } else {
+            for (std::size_t i = start; i < end; i++) errors[i] |= BATCH_INVALID_OPERATOR;
+        }
+        start = end;
+    }
+
+    for (std::size_t i = 0; i < count; i++) {
+        writeResult(result[i], errors[i]);
+    }
+    lines += count;
+    count = 0;
+}
+
+void StreamCalculator::writeResult(double value, std::uint8_t error) {
+    char* pos = outBuffer.data() + used;
+    const char* message = nullptr;
+    if (error & BATCH_INVALID_INPUT) message = "Error: Invalid input\n";
+    else if (error & BATCH_INVALID_OPERATOR) message = "Error: Invalid operator\n";
+    else if (error & BATCH_DIVISION_BY_ZERO) message = "Error: Division by zero\n";
+
+    if (message != nullptr) {
+        std::size_t len = std::strlen(message);
+        std::memcpy(pos, message, len);
+        pos += len;
+    } else {
+        pos = std::to_chars(pos, outBuffer.data() + outBuffer.size(), value).ptr;
+        *pos++ = '\n';
+    }
+    used = static_cast<std::size_t>(pos - outBuffer.data());
+    if (used >= OUT_FLUSH_AT) flushOutput();
+}
+
+bool StreamCalculator::flushOutput() {
+    if (used > 0 && std::fwrite(outBuffer.data(), 1, used, output) != used) writeFailed = true;
+    used = 0;
+    return !writeFailed;
+}
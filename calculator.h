@@ -0,0 +1,208 @@
+/// <task1: Basic Calculator> core: single operations, batch kernels, compiled
+/// expressions and the streaming evaluator
+#ifndef CALCULATOR_H
+#define CALCULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// @brief Error codes for the non-throwing calculate() API
+enum class CalcError : std::uint8_t { None, DivisionByZero, InvalidOperator };
+
+/// @brief Value-or-error result; value is 0 when error is set
+struct CalcResult {
+    double value;
+    CalcError error;
+
+    bool ok() const noexcept { return error == CalcError::None; }
+};
+
+/// @brief Message used when an error is reported as an exception
+inline const char* errorMessage(CalcError error) noexcept {
+    switch (error) {
+        case CalcError::DivisionByZero: return "Division by zero";
+        case CalcError::InvalidOperator: return "Invalid operator";
+        default: return "No error";
+    }
+}
+
+/// @brief Non-throwing fast path: the operator is chosen at run time
+inline CalcResult calculate(double a, char op, double b) noexcept {
+    switch (op) {
+        case '+': return {a + b, CalcError::None};
+        case '-': return {a - b, CalcError::None};
+        case '*': return {a * b, CalcError::None};
+        case '/':
+            if (b == 0) return {0, CalcError::DivisionByZero};
+            return {a / b, CalcError::None};
+        default:
+            return {0, CalcError::InvalidOperator};
+    }
+}
+
+/// @brief Compile-time specialization for callers that know the operator
+/// statically, e.g. calculate<'/'>(a, b): no dispatch, and only '/' can fail
+template <char Op>
+inline CalcResult calculate(double a, double b) noexcept {
+    static_assert(Op == '+' || Op == '-' || Op == '*' || Op == '/', "Invalid operator");
+    if constexpr (Op == '+') return {a + b, CalcError::None};
+    else if constexpr (Op == '-') return {a - b, CalcError::None};
+    else if constexpr (Op == '*') return {a * b, CalcError::None};
+    else return (b == 0) ? CalcResult{0, CalcError::DivisionByZero} : CalcResult{a / b, CalcError::None};
+}
+
+/// @brief I assume that the operations are binary operations
+class BasicOperation {
+    public:
+    double arg1, arg2;
+    char op;
+    double result;
+    BasicOperation(double a, char op, double b): arg1(a), arg2(b), op(op) {
+        CalcResult r = calculate(arg1, op, arg2);
+        if (!r.ok()) {
+            throw std::runtime_error(errorMessage(r.error));
+        }
+        result = r.value;
+    }
+
+};
+
+/// @brief Per-element error flags written by the batch API (0 = ok)
+const std::uint8_t BATCH_DIVISION_BY_ZERO = 1;
+const std::uint8_t BATCH_INVALID_OPERATOR = 2;
+const std::uint8_t BATCH_INVALID_INPUT = 4;
+
+/// @brief Applies one operator element-wise over structure-of-arrays columns:
+/// result[i] = arg1[i] op arg2[i], using AVX-512, AVX2 or scalar code depending
+/// on the CPU and several threads for large n. errors[i] is set to
+/// BATCH_DIVISION_BY_ZERO (result NaN) or 0; the return value is the number of
+/// flagged elements. An invalid operator throws.
+std::size_t evaluateBatch(char op, const double* arg1, const double* arg2, double* result, std::uint8_t* errors,
+                          std::size_t n);
+
+/// @brief Arithmetic expression (+ - * / unary minus, parentheses, numbers and
+/// named variables) compiled once into a flat postfix program. evaluate() runs
+/// that program on a fixed-size stack, so repeated evaluation does no parsing
+/// and no allocation. Syntax errors throw std::runtime_error from the constructor.
+class Expression {
+    public:
+    static const std::size_t MAX_STACK = 64;
+
+    explicit Expression(const std::string& source);
+
+    /// @brief Variables in order of first appearance; evaluate() takes their values in this order
+    const std::vector<std::string>& variables() const { return names; }
+
+    /// @brief Slot of a variable in the values array, or -1 if the expression doesn't use it
+    int variableIndex(const std::string& name) const;
+
+    /// @brief Runs the program on one set of values. Division by zero is
+    /// reported in the result rather than thrown, so bad input costs no more
+    /// than good input.
+    CalcResult evaluate(const double* values) const noexcept {
+        double stack[MAX_STACK];
+        std::size_t top = 0;
+
+        for (const Instruction& ins : program) {
+            switch (ins.code) {
+                case PUSH_CONST: stack[top++] = constants[ins.operand]; break;
+                case PUSH_VAR: stack[top++] = values[ins.operand]; break;
+                case NEG: stack[top - 1] = -stack[top - 1]; break;
+                case ADD: top--; stack[top - 1] += stack[top]; break;
+                case SUB: top--; stack[top - 1] -= stack[top]; break;
+                case MUL: top--; stack[top - 1] *= stack[top]; break;
+                case DIV:
+                    top--;
+                    if (stack[top] == 0) {
+                        return CalcResult{0, CalcError::DivisionByZero};
+                    }
+                    stack[top - 1] /= stack[top];
+                    break;
+            }
+        }
+        return CalcResult{stack[0], CalcError::None};
+    }
+
+    /// @brief Batch form of evaluate(): columns[v] holds n values of variable v
+    /// and result/errors behave as in the free evaluateBatch(). The program is run
+    /// one block at a time, each instruction as one vector kernel over the block.
+    std::size_t evaluateBatch(const double* const* columns, double* result, std::uint8_t* errors, std::size_t n) const;
+
+    private:
+    static constexpr std::size_t BATCH_BLOCK = 256;
+    static const std::size_t MAX_NESTING = 256; // parentheses and unary signs, bounds parser recursion
+
+    enum OpCode : std::uint8_t { PUSH_CONST, PUSH_VAR, NEG, ADD, SUB, MUL, DIV };
+    static constexpr const char* OP_CHARS = "  ~+-*/"; // batch kernel operator per OpCode
+
+    struct Instruction {
+        OpCode code;
+        std::uint32_t operand; // constant or variable slot for the PUSH codes
+    };
+
+    std::vector<Instruction> program;
+    std::vector<double> constants;
+    std::vector<std::string> names;
+
+    // Parser state, only used while compiling
+    std::string source;
+    std::size_t pos;
+    std::size_t depth;
+    std::size_t maxDepth;
+    std::size_t nesting;
+
+    void evaluateBlock(const double* const* columns, std::size_t offset, std::size_t n, double* scratch,
+                       double* result, std::uint8_t* errors) const;
+
+    [[noreturn]] void fail(const char* message) const;
+    void skipSpaces();
+    void push(OpCode code, std::uint32_t operand);
+    void enterNested();
+    void emitBinary(OpCode code);
+    void parseSum();
+    void parseProduct();
+    void parseUnary();
+    void parsePrimary();
+};
+
+/// @brief Streaming mode: reads "num op num" lines (spaces, tabs or commas between
+/// the fields, so "3 * 4" and "3,*,4" both work) from a file or stdin, parses them
+/// with std::from_chars, evaluates them in batches and writes one result or error
+/// per line through a single large output buffer. Blank lines are skipped.
+class StreamCalculator {
+    public:
+    static const std::size_t BATCH_SIZE = 4096;
+
+    explicit StreamCalculator(std::FILE* output);
+
+    /// @brief Reads 'input' to the end; returns false on a read or write error
+    bool run(std::FILE* input);
+
+    std::size_t lineCount() const { return lines; }
+
+    private:
+    static const std::size_t READ_CHUNK = std::size_t(1) << 20;
+    static const std::size_t OUT_FLUSH_AT = std::size_t(1) << 20;
+
+    std::FILE* output;
+    std::size_t count; // lines waiting in the batch
+    std::size_t lines; // lines processed in total
+    std::size_t used;  // bytes waiting in outBuffer
+    bool writeFailed = false;
+    std::vector<double> arg1, arg2, result;
+    std::vector<char> ops;
+    std::vector<std::uint8_t> errors;
+    std::vector<char> outBuffer;
+
+    static const char* skipSeparators(const char* pos, const char* end);
+    void addLine(const char* pos, const char* end);
+    void evaluatePending();
+    void writeResult(double value, std::uint8_t error);
+    bool flushOutput();
+};
+
+#endif
@@ -0,0 +1,217 @@
+// File system simulation core: the in-memory file table and its on-disk mirror
+#include "file_system.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include "metrics.h"
+using namespace std;
+
+METRICS_HISTOGRAM(createLatency, "file_system.create");
+METRICS_HISTOGRAM(deleteLatency, "file_system.delete");
+METRICS_HISTOGRAM(readLatency, "file_system.read");
+METRICS_HISTOGRAM(writeLatency, "file_system.write");
+METRICS_HISTOGRAM(findLatency, "file_system.find");
+METRICS_COUNTER(filesCreated, "file_system.files_created");
+METRICS_COUNTER(filesDeleted, "file_system.files_deleted");
+METRICS_COUNTER(filesRead, "file_system.files_read");
+METRICS_COUNTER(bytesWritten, "file_system.bytes_written");
+
+FileSystem::FileSystem() {
+    fileCount = 0;
+    for (int i = 0; i < MAX_FILES; i++) {
+        files[i] = nullptr;
+    }
+}
+
+FileSystem::~FileSystem() {
+    for (int i = 0; i < fileCount; i++) {
+        delete files[i];
+    }
+}
+
+// Create a new file
+bool FileSystem::createFile(const char* filename, const char* content) {
+    METRICS_TIME(createLatency);
+
+    // Check if file already exists
+    if (findFile(filename) != -1) {
+        cout << "Error: File '" << filename << "' already exists!" << endl;
+        return false;
+    }
+
+    // Check if we've reached maximum files
+    if (fileCount >= MAX_FILES) {
+        cout << "Error: Maximum file limit reached!" << endl;
+        return false;
+    }
+
+    // Validate filename
+    if (strlen(filename) == 0 || strlen(filename) >= MAX_FILENAME) {
+        cout << "Error: Invalid filename!" << endl;
+        return false;
+    }
+
+    // Create new file
+    File* newFile = new File();
+    strcpy(newFile->name, filename);
+    strcpy(newFile->content, content);
+    newFile->size = strlen(content);
+    newFile->createdTime = time(nullptr);
+    newFile->exists = true;
+
+    files[fileCount++] = newFile;
+
+    // Write to actual file
+    ofstream outFile(filename);
+    if (!outFile) {
+        cout << "Error: Could not create physical file!" << endl;
+        delete newFile;
+        fileCount--;
+        return false;
+    }
+    outFile << content;
+    outFile.close();
+
+    METRICS_INC(filesCreated);
+    METRICS_ADD(bytesWritten, newFile->size);
+    cout << "Success: File '" << filename << "' created successfully!" << endl;
+    return true;
+}
+
+// Delete a file
+bool FileSystem::deleteFile(const char* filename) {
+    METRICS_TIME(deleteLatency);
+
+    int index = findFile(filename);
+    if (index == -1) {
+        cout << "Error: File '" << filename << "' not found!" << endl;
+        return false;
+    }
+
+    // Delete physical file
+    if (remove(filename) != 0) {
+        cout << "Warning: Could not delete physical file, but removing from system." << endl;
+    }
+
+    // Mark as deleted and remove from array
+    delete files[index];
+    
+    // Shift remaining files
+    for (int i = index; i < fileCount - 1; i++) {
+        files[i] = files[i + 1];
+    }
+    files[fileCount - 1] = nullptr;
+    fileCount--;
+
+    METRICS_INC(filesDeleted);
+    cout << "Success: File '" << filename << "' deleted successfully!" << endl;
+    return true;
+}
+
+// Read a file
+bool FileSystem::readFile(const char* filename) {
+    METRICS_TIME(readLatency);
+
+    int index = findFile(filename);
+    if (index == -1) {
+        cout << "Error: File '" << filename << "' not found!" << endl;
+        return false;
+    }
+
+    // Read from actual file
+    ifstream inFile(filename);
+    if (!inFile) {
+        cout << "Error: Could not open file for reading!" << endl;
+        return false;
+    }
+
+    cout << "\n====================================" << endl;
+    cout << "         FILE CONTENT               " << endl;
+    cout << "====================================" << endl;
+    cout << "Filename: " << files[index]->name << endl;
+    cout << "Size: " << files[index]->size << " bytes" << endl;
+    cout << "Created: " << ctime(&files[index]->createdTime);
+    cout << "------------------------------------" << endl;
+
+    string line;
+    while (getline(inFile, line)) {
+        cout << line << endl;
+    }
+    cout << "====================================" << endl;
+    inFile.close();
+
+    METRICS_INC(filesRead);
+    return true;
+}
+
+// Write/Append to a file
+bool FileSystem::writeFile(const char* filename, const char* content, bool append) {
+    METRICS_TIME(writeLatency);
+
+    int index = findFile(filename);
+    if (index == -1) {
+        cout << "Error: File '" << filename << "' not found!" << endl;
+        return false;
+    }
+
+    // Write to actual file
+    ofstream outFile;
+    if (append) {
+        outFile.open(filename, ios::app);
+    } else {
+        outFile.open(filename);
+    }
+
+    if (!outFile) {
+        cout << "Error: Could not open file for writing!" << endl;
+        return false;
+    }
+
+    outFile << content;
+    outFile.close();
+
+    // Update file info
+    if (append) {
+        strcat(files[index]->content, content);
+    } else {
+        strcpy(files[index]->content, content);
+    }
+    files[index]->size = strlen(files[index]->content);
+
+    METRICS_ADD(bytesWritten, strlen(content));
+    cout << "Success: Content written to '" << filename << "'!" << endl;
+    return true;
+}
+
+// List all files
+void FileSystem::listFiles() {
+    if (fileCount == 0) {
+        cout << "\nNo files in the system." << endl;
+        return;
+    }
+
+    cout << "\n====================================" << endl;
+    cout << "          FILE LIST                 " << endl;
+    cout << "====================================" << endl;
+    cout << "Total Files: " << fileCount << endl;
+    cout << "------------------------------------" << endl;
+    for (int i = 0; i < fileCount; i++) {
+        cout << (i + 1) << ". " << files[i]->name;
+        cout << " (" << files[i]->size << " bytes)" << endl;
+    }
+    cout << "====================================" << endl;
+}
+
+// Find file by name (returns index or -1 if not found)
+int FileSystem::findFile(const char* filename) {
+    METRICS_TIME(findLatency);
+
+    for (int i = 0; i < fileCount; i++) {
+        if (strcmp(files[i]->name, filename) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,52 @@
+// File system simulation core: the in-memory file table and its on-disk mirror
+#ifndef FILE_SYSTEM_H
+#define FILE_SYSTEM_H
+
+#include <ctime>
+
+const int MAX_FILES = 100;
+const int MAX_FILENAME = 50;
+
+// Structure to represent a file in our simulation
+struct File {
+    char name[MAX_FILENAME];
+    char content[500];
+    int size;
+    time_t createdTime;
+    bool exists;
+};
+
+// File System class to manage operations
+class FileSystem {
+private:
+    File* files[MAX_FILES];
+    int fileCount;
+
+public:
+    FileSystem();
+    ~FileSystem();
+
+    // Create a new file
+    bool createFile(const char* filename, const char* content);
+
+    // Delete a file
+    bool deleteFile(const char* filename);
+
+    // Read a file
+    bool readFile(const char* filename);
+
+    // Write/Append to a file
+    bool writeFile(const char* filename, const char* content, bool append = false);
+
+    // List all files
+    void listFiles();
+
+    // Find file by name (returns index or -1 if not found)
+    int findFile(const char* filename);
+
+    int getFileCount() const {
+        return fileCount;
+    }
+};
+
+#endif
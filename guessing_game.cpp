@@ -0,0 +1,21 @@
+///Number Guessing Game core
+#include "guessing_game.h"
+
+std::unique_ptr<Guesser> makeGuesser(const std::string& name, std::uint64_t seed) {
+    if (name == "binary") return std::unique_ptr<Guesser>(new BinarySearchGuesser());
+    if (name == "random") return std::unique_ptr<Guesser>(new RandomGuesser(seed));
+    if (name == "interpolation") return std::unique_ptr<Guesser>(new InterpolationGuesser());
+    return nullptr;
+}
+
+int playGame(Guesser& guesser, std::uint64_t target, std::uint64_t low, std::uint64_t high, int maxAttempts) {
+    guesser.reset(low, high);
+    for (int attempts = 1; attempts <= maxAttempts; attempts++) {
+        std::uint64_t guess = guesser.guess();
+        if (guess == target) {
+            return attempts;
+        }
+        guesser.feedback(guess < target ? Feedback::TooLow : Feedback::TooHigh);
+    }
+    return 0;
+}
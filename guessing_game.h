@@ -0,0 +1,128 @@
+///Number Guessing Game core: PRNG, guessing strategies and the game loop
+#ifndef GUESSING_GAME_H
+#define GUESSING_GAME_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Fast per-thread PRNG (xoshiro256**), seeded through splitmix64
+class FastRandom {
+private:
+    std::uint64_t s[4];
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    explicit FastRandom(std::uint64_t seed) {
+        for (int i = 0; i < 4; i++) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            s[i] = z ^ (z >> 31);
+        }
+    }
+
+    std::uint64_t next() {
+        std::uint64_t result = rotl(s[1] * 5, 7) * 9;
+        std::uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+    // Uniform value in [low, high] (multiply-shift, no division)
+    std::uint64_t between(std::uint64_t low, std::uint64_t high) {
+        std::uint64_t span = high - low + 1; // 0 means the full 64-bit range
+        if (span == 0) return next();
+        return low + static_cast<std::uint64_t>((static_cast<unsigned __int128>(next()) * span) >> 64);
+    }
+};
+
+enum class Feedback { TooLow, TooHigh };
+
+// A guessing strategy: reset() starts a game over [low, high], then guess()
+// and feedback() alternate until a guess is right
+class Guesser {
+public:
+    virtual ~Guesser() = default;
+    virtual void reset(std::uint64_t low, std::uint64_t high) = 0;
+    virtual std::uint64_t guess() = 0;
+    virtual void feedback(Feedback result) = 0;
+};
+
+// Keeps the range the target can still be in; strategies differ only in where they probe it
+class RangeGuesser : public Guesser {
+protected:
+    std::uint64_t low = 0;
+    std::uint64_t high = 0;
+    std::uint64_t last = 0;
+
+public:
+    void reset(std::uint64_t rangeLow, std::uint64_t rangeHigh) override {
+        low = rangeLow;
+        high = rangeHigh;
+    }
+
+    void feedback(Feedback result) override {
+        if (result == Feedback::TooLow) {
+            low = last + 1;
+        } else {
+            high = last - 1;
+        }
+    }
+};
+
+// Always probes the middle: optimal for a uniformly drawn target
+class BinarySearchGuesser : public RangeGuesser {
+public:
+    std::uint64_t guess() override {
+        last = low + (high - low) / 2;
+        return last;
+    }
+};
+
+// Probes a uniformly random point of the remaining range
+class RandomGuesser : public RangeGuesser {
+private:
+    FastRandom rng;
+
+public:
+    explicit RandomGuesser(std::uint64_t seed) : rng(seed) {}
+
+    std::uint64_t guess() override {
+        last = rng.between(low, high);
+        return last;
+    }
+};
+
+// Probes at a fixed fraction of the remaining range. With only higher/lower
+// feedback there are no key values to interpolate between, so this is the
+// skewed split interpolation search degenerates to; 0.5 is binary search.
+class InterpolationGuesser : public RangeGuesser {
+private:
+    double fraction;
+
+public:
+    explicit InterpolationGuesser(double fraction = 1.0 / 3.0) : fraction(fraction) {}
+
+    std::uint64_t guess() override {
+        last = low + static_cast<std::uint64_t>(static_cast<long double>(high - low) * fraction);
+        return last;
+    }
+};
+
+// Strategy by name ("binary", "random" or "interpolation"); nullptr if unknown
+std::unique_ptr<Guesser> makeGuesser(const std::string& name, std::uint64_t seed);
+
+// Plays one game; returns the number of attempts, or 0 if maxAttempts ran out
+int playGame(Guesser& guesser, std::uint64_t target, std::uint64_t low, std::uint64_t high, int maxAttempts);
+
+#endif
@@ -1,217 +1,8 @@
 #include <iostream>
-#include <fstream>
-#include <cstring>
-#include <ctime>
-#include <string>
+#include "file_system.h"
+#include "metrics.h"
 using namespace std;
 
-const int MAX_FILES = 100;
-const int MAX_FILENAME = 50;
-
-// Structure to represent a file in our simulation
-struct File {
-    char name[MAX_FILENAME];
-    char content[500];
-    int size;
-    time_t createdTime;
-    bool exists;
-};
-
-// File System class to manage operations
-class FileSystem {
-private:
-    File* files[MAX_FILES];
-    int fileCount;
-
-public:
-    FileSystem() {
-        fileCount = 0;
-        for (int i = 0; i < MAX_FILES; i++) {
-            files[i] = nullptr;
-        }
-    }
-
-    ~FileSystem() {
-        for (int i = 0; i < fileCount; i++) {
-            delete files[i];
-        }
-    }
-
-    // Create a new file
-    bool createFile(const char* filename, const char* content) {
-        // Check if file already exists
-        if (findFile(filename) != -1) {
-            cout << "Error: File '" << filename << "' already exists!" << endl;
-            return false;
-        }
-
-        // Check if we've reached maximum files
-        if (fileCount >= MAX_FILES) {
-            cout << "Error: Maximum file limit reached!" << endl;
-            return false;
-        }
-
-        // Validate filename
-        if (strlen(filename) == 0 || strlen(filename) >= MAX_FILENAME) {
-            cout << "Error: Invalid filename!" << endl;
-            return false;
-        }
-
-        // Create new file
-        File* newFile = new File();
-        strcpy(newFile->name, filename);
-        strcpy(newFile->content, content);
-        newFile->size = strlen(content);
-        newFile->createdTime = time(nullptr);
-        newFile->exists = true;
-
-        files[fileCount++] = newFile;
-
-        // Write to actual file
-        ofstream outFile(filename);
-        if (!outFile) {
-            cout << "Error: Could not create physical file!" << endl;
-            delete newFile;
-            fileCount--;
-            return false;
-        }
-        outFile << content;
-        outFile.close();
-
-        cout << "Success: File '" << filename << "' created successfully!" << endl;
-        return true;
-    }
-
-    // Delete a file
-    bool deleteFile(const char* filename) {
-        int index = findFile(filename);
-        if (index == -1) {
-            cout << "Error: File '" << filename << "' not found!" << endl;
-            return false;
-        }
-
-        // Delete physical file
-        if (remove(filename) != 0) {
-            cout << "Warning: Could not delete physical file, but removing from system." << endl;
-        }
-
-        // Mark as deleted and remove from array
-        delete files[index];
-        
-        // Shift remaining files
-        for (int i = index; i < fileCount - 1; i++) {
-            files[i] = files[i + 1];
-        }
-        files[fileCount - 1] = nullptr;
-        fileCount--;
-
-        cout << "Success: File '" << filename << "' deleted successfully!" << endl;
-        return true;
-    }
-
-    // Read a file
-    bool readFile(const char* filename) {
-        int index = findFile(filename);
-        if (index == -1) {
-            cout << "Error: File '" << filename << "' not found!" << endl;
-            return false;
-        }
-
-        // Read from actual file
-        ifstream inFile(filename);
-        if (!inFile) {
-            cout << "Error: Could not open file for reading!" << endl;
-            return false;
-        }
-
-        cout << "\n====================================" << endl;
-        cout << "         FILE CONTENT               " << endl;
-        cout << "====================================" << endl;
-        cout << "Filename: " << files[index]->name << endl;
-        cout << "Size: " << files[index]->size << " bytes" << endl;
-        cout << "Created: " << ctime(&files[index]->createdTime);
-        cout << "------------------------------------" << endl;
-
-        string line;
-        while (getline(inFile, line)) {
-            cout << line << endl;
-        }
-        cout << "====================================" << endl;
-        inFile.close();
-
-        return true;
-    }
-
-    // Write/Append to a file
-    bool writeFile(const char* filename, const char* content, bool append = false) {
-        int index = findFile(filename);
-        if (index == -1) {
-            cout << "Error: File '" << filename << "' not found!" << endl;
-            return false;
-        }
-
-        // Write to actual file
-        ofstream outFile;
-        if (append) {
-            outFile.open(filename, ios::app);
-        } else {
-            outFile.open(filename);
-        }
-
-        if (!outFile) {
-            cout << "Error: Could not open file for writing!" << endl;
-            return false;
-        }
-
-        outFile << content;
-        outFile.close();
-
-        // Update file info
-        if (append) {
-            strcat(files[index]->content, content);
-        } else {
-            strcpy(files[index]->content, content);
-        }
-        files[index]->size = strlen(files[index]->content);
-
-        cout << "Success: Content written to '" << filename << "'!" << endl;
-        return true;
-    }
-
-    // List all files
-    void listFiles() {
-        if (fileCount == 0) {
-            cout << "\nNo files in the system." << endl;
-            return;
-        }
-
-        cout << "\n====================================" << endl;
-        cout << "          FILE LIST                 " << endl;
-        cout << "====================================" << endl;
-        cout << "Total Files: " << fileCount << endl;
-        cout << "------------------------------------" << endl;
-        for (int i = 0; i < fileCount; i++) {
-            cout << (i + 1) << ". " << files[i]->name;
-            cout << " (" << files[i]->size << " bytes)" << endl;
-        }
-        cout << "====================================" << endl;
-    }
-
-    // Find file by name (returns index or -1 if not found)
-    int findFile(const char* filename) {
-        for (int i = 0; i < fileCount; i++) {
-            if (strcmp(files[i]->name, filename) == 0) {
-                return i;
-            }
-        }
-        return -1;
-    }
-
-    int getFileCount() const {
-        return fileCount;
-    }
-};
-
 // Display menu
 void displayMenu() {
     cout << "\n========================================" << endl;
@@ -234,6 +25,9 @@ int main() {
     char filename[MAX_FILENAME];
     char content[500];
 
+    // Counters and latencies go to level3-task1.metrics.json on SIGUSR1
+    METRICS_INIT("level3-task1.metrics.json");
+
     cout << "Welcome to File System Simulation!" << endl;
 
     do {
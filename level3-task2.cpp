@@ -3,6 +3,8 @@
 #include <unistd.h>
 #include <cstdlib>
 #include <ctime>
+#include "bounded_buffer.h"
+#include "metrics.h"
 
 using namespace std;
 
@@ -10,42 +12,13 @@ using namespace std;
 const int BUFFER_SIZE = 10;
 const int MAX_ITEMS = 20;
 
-// Shared buffer and counters
-int buffer[BUFFER_SIZE];
-int count = 0;           // Current items in buffer
-int in = 0;              // Producer index
-int out = 0;             // Consumer index
-int produced_total = 0;  // Total items produced
-int consumed_total = 0;  // Total items consumed
-
-// Synchronization primitives
-pthread_mutex_t mutex;
-pthread_cond_t not_full;
-pthread_cond_t not_empty;
-
-// Thread control
-bool production_done = false;
-
 // Structure to pass thread arguments
 struct ThreadArgs {
     int id;
     int items_to_process;
+    BoundedBuffer* buffer;
 };
 
-// Function to display buffer state (for debugging/visualization)
-void displayBuffer() {
-    cout << "Buffer [";
-    for (int i = 0; i < BUFFER_SIZE; i++) {
-        if (i < count) {
-            cout << buffer[(out + i) % BUFFER_SIZE];
-        } else {
-            cout << "_";
-        }
-        if (i < BUFFER_SIZE - 1) cout << " ";
-    }
-    cout << "] Count: " << count << "/" << BUFFER_SIZE << endl;
-}
-
 // Producer thread function
 void* producer(void* arg) {
     ThreadArgs* args = (ThreadArgs*)arg;
@@ -59,30 +32,8 @@ void* producer(void* arg) {
         // Simulate production time
         usleep((rand() % 500 + 100) * 1000); // 100-600ms
 
-        // Lock the mutex before accessing shared resources
-        pthread_mutex_lock(&mutex);
-
-        // Wait while buffer is full
-        while (count == BUFFER_SIZE) {
-            cout << "Producer " << producer_id << " waiting (buffer full)..." << endl;
-            pthread_cond_wait(&not_full, &mutex);
-        }
-
-        // Add item to buffer
-        buffer[in] = item;
-        in = (in + 1) % BUFFER_SIZE;
-        count++;
-        produced_total++;
-
-        cout << ">>> Producer " << producer_id << " produced item: " << item 
-             << " (Total produced: " << produced_total << ")" << endl;
-        displayBuffer();
-
-        // Signal that buffer is not empty
-        pthread_cond_signal(&not_empty);
-
-        // Unlock the mutex
-        pthread_mutex_unlock(&mutex);
+        // Add item to buffer (waits while it is full)
+        args->buffer->put(item, producer_id);
     }
 
     cout << "*** Producer " << producer_id << " finished production ***" << endl;
@@ -97,38 +48,15 @@ void* consumer(void* arg) {
     int items = args->items_to_process;
 
     for (int i = 0; i < items; i++) {
-        // Lock the mutex before accessing shared resources
-        pthread_mutex_lock(&mutex);
-
-        // Wait while buffer is empty
-        while (count == 0) {
-            // Check if production is done and buffer is empty
-            if (production_done && count == 0) {
-                pthread_mutex_unlock(&mutex);
-                cout << "*** Consumer " << consumer_id << " detected production done and buffer empty ***" << endl;
-                delete args;
-                return nullptr;
-            }
-            cout << "Consumer " << consumer_id << " waiting (buffer empty)..." << endl;
-            pthread_cond_wait(&not_empty, &mutex);
+        // Remove item from buffer (waits while it is empty)
+        int item;
+        if (!args->buffer->take(item, consumer_id)) {
+            // Production is done and the buffer is empty
+            cout << "*** Consumer " << consumer_id << " detected production done and buffer empty ***" << endl;
+            delete args;
+            return nullptr;
         }
 
-        // Remove item from buffer
-        int item = buffer[out];
-        out = (out + 1) % BUFFER_SIZE;
-        count--;
-        consumed_total++;
-
-        cout << "<<< Consumer " << consumer_id << " consumed item: " << item 
-             << " (Total consumed: " << consumed_total << ")" << endl;
-        displayBuffer();
-
-        // Signal that buffer is not full
-        pthread_cond_signal(&not_full);
-
-        // Unlock the mutex
-        pthread_mutex_unlock(&mutex);
-
         // Simulate consumption time
         usleep((rand() % 500 + 100) * 1000); // 100-600ms
     }
@@ -142,6 +70,9 @@ int main() {
     // Seed random number generator
     srand(time(nullptr));
 
+    // Counters and latencies go to level3-task2.metrics.json on SIGUSR1
+    METRICS_INIT("level3-task2.metrics.json");
+
     cout << "========================================" << endl;
     cout << "  PRODUCER-CONSUMER SIMULATION         " << endl;
     cout << "========================================" << endl;
@@ -149,10 +80,8 @@ int main() {
     cout << "Max Items: " << MAX_ITEMS << endl;
     cout << "========================================\n" << endl;
 
-    // Initialize mutex and condition variables
-    pthread_mutex_init(&mutex, nullptr);
-    pthread_cond_init(&not_full, nullptr);
-    pthread_cond_init(&not_empty, nullptr);
+    // Shared buffer, logging every operation
+    BoundedBuffer buffer(BUFFER_SIZE, true);
 
     // Create thread arrays
     const int NUM_PRODUCERS = 2;
@@ -170,6 +99,7 @@ int main() {
         ThreadArgs* args = new ThreadArgs;
         args->id = i + 1;
         args->items_to_process = items_per_producer;
+        args->buffer = &buffer;
         
         if (pthread_create(&producers[i], nullptr, producer, args) != 0) {
             cerr << "Error creating producer thread " << i + 1 << endl;
@@ -185,6 +115,7 @@ int main() {
         ThreadArgs* args = new ThreadArgs;
         args->id = i + 1;
         args->items_to_process = items_per_consumer;
+        args->buffer = &buffer;
         
         if (pthread_create(&consumers[i], nullptr, consumer, args) != 0) {
             cerr << "Error creating consumer thread " << i + 1 << endl;
@@ -201,11 +132,8 @@ int main() {
         pthread_join(producers[i], nullptr);
     }
 
-    // Mark production as done
-    pthread_mutex_lock(&mutex);
-    production_done = true;
-    pthread_cond_broadcast(&not_empty); // Wake up all waiting consumers
-    pthread_mutex_unlock(&mutex);
+    // Mark production as done and wake up all waiting consumers
+    buffer.close();
 
     cout << "\n*** All producers finished ***\n" << endl;
 
@@ -220,15 +148,10 @@ int main() {
     cout << "\n========================================" << endl;
     cout << "         SIMULATION COMPLETE            " << endl;
     cout << "========================================" << endl;
-    cout << "Total items produced: " << produced_total << endl;
-    cout << "Total items consumed: " << consumed_total << endl;
-    cout << "Final buffer count: " << count << endl;
+    cout << "Total items produced: " << buffer.produced() << endl;
+    cout << "Total items consumed: " << buffer.consumed() << endl;
+    cout << "Final buffer count: " << buffer.size() << endl;
     cout << "========================================" << endl;
 
-    // Cleanup
-    pthread_mutex_destroy(&mutex);
-    pthread_cond_destroy(&not_full);
-    pthread_cond_destroy(&not_empty);
-
     return 0;
 }
\ No newline at end of file
@@ -1,36 +1,24 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include "tic_tac_toe.h"
+#include "metrics.h"
 using namespace std;
 
-const int BOARD_SIZE = 3;
-const char PLAYER_X = 'X';
-const char PLAYER_O = 'O';
-const char EMPTY = ' ';
-
 // Game board
 char board[BOARD_SIZE][BOARD_SIZE];
 
+// Counted here rather than in checkWin(), which is also called on boards
+// that are only being inspected
+METRICS_COUNTER(gamesWon, "tic_tac_toe.wins");
+
 // Function prototypes
-void initializeBoard();
 void displayBoard();
-bool makeMove(int row, int col, char player);
-bool checkWin(char player);
-bool checkDraw();
 void clearScreen();
 bool playAgain();
 void displayWelcome();
 void displayGameRules();
 
-// Initialize the game board with empty spaces
-void initializeBoard() {
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            board[i][j] = EMPTY;
-        }
-    }
-}
-
 // Clear screen (works on most terminals)
 void clearScreen() {
     #ifdef _WIN32
@@ -85,66 +73,6 @@ void displayBoard() {
     cout << "   -------------" << endl;
 }
 
-// Make a move on the board
-bool makeMove(int row, int col, char player) {
-    // Validate input
-    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE) {
-        cout << "Error: Invalid position! Row and column must be 1-3." << endl;
-        return false;
-    }
-    
-    // Check if position is already occupied
-    if (board[row][col] != EMPTY) {
-        cout << "Error: Position already occupied! Choose another spot." << endl;
-        return false;
-    }
-    
-    // Place the move
-    board[row][col] = player;
-    return true;
-}
-
-// Check if a player has won
-bool checkWin(char player) {
-    // Check rows
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i][0] == player && board[i][1] == player && board[i][2] == player) {
-            return true;
-        }
-    }
-    
-    // Check columns
-    for (int j = 0; j < BOARD_SIZE; j++) {
-        if (board[0][j] == player && board[1][j] == player && board[2][j] == player) {
-            return true;
-        }
-    }
-    
-    // Check diagonal (top-left to bottom-right)
-    if (board[0][0] == player && board[1][1] == player && board[2][2] == player) {
-        return true;
-    }
-    
-    // Check diagonal (top-right to bottom-left)
-    if (board[0][2] == player && board[1][1] == player && board[2][0] == player) {
-        return true;
-    }
-    
-    return false;
-}
-
-// Check if the game is a draw
-bool checkDraw() {
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            if (board[i][j] == EMPTY) {
-                return false; // Found an empty space, not a draw
-            }
-        }
-    }
-    return true; // No empty spaces and no winner = draw
-}
-
 // Ask if players want to play again
 bool playAgain() {
     char choice;
@@ -162,7 +90,7 @@ void playGame() {
     int moveCount = 0;
     bool gameOver = false;
     
-    initializeBoard();
+    initializeBoard(board);
     
     while (!gameOver) {
         clearScreen();
@@ -198,11 +126,12 @@ void playGame() {
         col--;
         
         // Try to make the move
-        if (makeMove(row, col, currentPlayer)) {
+        if (makeMove(board, row, col, currentPlayer)) {
             moveCount++;
             
             // Check for win
-            if (checkWin(currentPlayer)) {
+            if (checkWin(board, currentPlayer)) {
+                METRICS_INC(gamesWon);
                 clearScreen();
                 displayWelcome();
                 displayBoard();
@@ -212,7 +141,7 @@ void playGame() {
                 gameOver = true;
             }
             // Check for draw
-            else if (checkDraw()) {
+            else if (checkDraw(board)) {
                 clearScreen();
                 displayWelcome();
                 displayBoard();
@@ -237,6 +166,9 @@ void playGame() {
 }
 
 int main() {
+    // Counters and latencies go to level3-task3.metrics.json on SIGUSR1
+    METRICS_INIT("level3-task3.metrics.json");
+
     displayWelcome();
     displayGameRules();
     
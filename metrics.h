@@ -0,0 +1,417 @@
+// Hot-path metrics: named counters and latency histograms, header-only.
+//
+// Every thread writes into its own block of slots with plain relaxed stores,
+// so recording never contends; blocks are summed when a snapshot is taken,
+// and a thread's totals are folded into the shared ones when it exits.
+// Latencies are measured in rdtsc ticks on x86 (steady_clock nanoseconds
+// elsewhere, or with METRICS_USE_STEADY_CLOCK) and kept in log-linear
+// buckets: 8 per power of two, so any value is within 12.5% of its bucket.
+//
+// Use it through the macros, which compile to nothing with -DMETRICS_DISABLED:
+//   METRICS_COUNTER(filesCreated, "file_system.files_created");  // file scope
+//   METRICS_HISTOGRAM(createLatency, "file_system.create");
+//   METRICS_INC(filesCreated);  METRICS_ADD(bytesWritten, n);
+//   METRICS_TIME(createLatency);  // times the rest of the enclosing scope
+//   METRICS_INIT("program.metrics.json");  // in main(): dump on SIGUSR1
+//   METRICS_DUMP();  // write a snapshot now
+// The dump path can be overridden with the METRICS_FILE environment
+// variable; when it is set, a final snapshot is also written at exit.
+#ifndef METRICS_H
+#define METRICS_H
+
+#ifndef METRICS_DISABLED
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(METRICS_USE_STEADY_CLOCK)
+#include <x86intrin.h>
+#define METRICS_RDTSC 1
+#endif
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace metrics {
+
+const int MAX_COUNTERS = 64;
+const int MAX_HISTOGRAMS = 16;
+
+// Values below 8 get a bucket each; above that, each power of two is split
+// into 8 equal sub-buckets
+const int SUB_BUCKET_BITS = 3;
+const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+const int BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+inline int bucketIndex(std::uint64_t value) {
+    if (value < static_cast<std::uint64_t>(SUB_BUCKETS)) return static_cast<int>(value);
+    int exponent = 63 - __builtin_clzll(value);
+    int sub = static_cast<int>(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+// Smallest value that falls into bucket 'index'
+inline std::uint64_t bucketLowerBound(int index) {
+    if (index < SUB_BUCKETS) return static_cast<std::uint64_t>(index);
+    int exponent = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    std::uint64_t sub = static_cast<std::uint64_t>(index % SUB_BUCKETS);
+    return (std::uint64_t(1) << exponent) | (sub << (exponent - SUB_BUCKET_BITS));
+}
+
+inline std::uint64_t ticks() {
+#ifdef METRICS_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+#endif
+}
+
+// Only the owning thread writes a slot, so a relaxed load + store is enough
+// and avoids a locked read-modify-write on the hot path
+inline void bump(std::atomic<std::uint64_t>& slot, std::uint64_t n) {
+    slot.store(slot.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+struct HistogramSlots {
+    std::atomic<std::uint64_t> buckets[BUCKETS];
+    std::atomic<std::uint64_t> count;
+    std::atomic<std::uint64_t> sum;
+    std::atomic<std::uint64_t> max;
+};
+
+// One per thread. The extra slot at the end of each array absorbs
+// registrations past the limit, so recording never has to check an id.
+struct ThreadBlock {
+    std::atomic<std::uint64_t> counters[MAX_COUNTERS + 1];
+    HistogramSlots histograms[MAX_HISTOGRAMS + 1];
+
+    ThreadBlock() { clear(); }
+
+    void clear() {
+        for (std::atomic<std::uint64_t>& c : counters) c.store(0, std::memory_order_relaxed);
+        for (HistogramSlots& h : histograms) {
+            for (std::atomic<std::uint64_t>& b : h.buckets) b.store(0, std::memory_order_relaxed);
+            h.count.store(0, std::memory_order_relaxed);
+            h.sum.store(0, std::memory_order_relaxed);
+            h.max.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    // Adds this block's values into 'total' (called with the registry locked)
+    void addTo(ThreadBlock& total) const {
+        for (int i = 0; i < MAX_COUNTERS; i++) {
+            bump(total.counters[i], counters[i].load(std::memory_order_relaxed));
+        }
+        for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+            const HistogramSlots& from = histograms[i];
+            HistogramSlots& to = total.histograms[i];
+            for (int b = 0; b < BUCKETS; b++) bump(to.buckets[b], from.buckets[b].load(std::memory_order_relaxed));
+            bump(to.count, from.count.load(std::memory_order_relaxed));
+            bump(to.sum, from.sum.load(std::memory_order_relaxed));
+            std::uint64_t max = from.max.load(std::memory_order_relaxed);
+            if (max > to.max.load(std::memory_order_relaxed)) to.max.store(max, std::memory_order_relaxed);
+        }
+    }
+};
+
+class Registry {
+private:
+    std::mutex mutex;
+    std::vector<std::string> counterNames;
+    std::vector<std::string> histogramNames;
+    std::vector<ThreadBlock*> live;
+    ThreadBlock retired; // totals of threads that have exited
+    std::uint64_t startTicks;
+    std::chrono::steady_clock::time_point startTime;
+
+public:
+    std::string dumpPath;
+
+    Registry() : startTicks(ticks()), startTime(std::chrono::steady_clock::now()) {}
+
+    int addCounter(const char* name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        counterNames.push_back(name);
+        return std::min(static_cast<int>(counterNames.size()) - 1, MAX_COUNTERS);
+    }
+
+    int addHistogram(const char* name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        histogramNames.push_back(name);
+        return std::min(static_cast<int>(histogramNames.size()) - 1, MAX_HISTOGRAMS);
+    }
+
+    void attach(ThreadBlock* block) {
+        std::lock_guard<std::mutex> lock(mutex);
+        live.push_back(block);
+    }
+
+    void retire(ThreadBlock* block) {
+        std::lock_guard<std::mutex> lock(mutex);
+        block->addTo(retired);
+        for (std::size_t i = 0; i < live.size(); i++) {
+            if (live[i] == block) {
+                live[i] = live.back();
+                live.pop_back();
+                break;
+            }
+        }
+    }
+
+    // Ticks per nanosecond, measured against steady_clock since startup
+    double ticksPerNs() {
+#ifdef METRICS_RDTSC
+        auto elapsed = std::chrono::steady_clock::now() - startTime;
+        if (elapsed < std::chrono::milliseconds(10)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10) - elapsed);
+        }
+        std::uint64_t tickCount = ticks() - startTicks;
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+        return static_cast<double>(tickCount) / ns;
+#else
+        return 1.0;
+#endif
+    }
+
+    // Sums every live thread's block and the retired totals into 'total'
+    void collect(ThreadBlock& total, std::vector<std::string>& counters, std::vector<std::string>& histograms) {
+        std::lock_guard<std::mutex> lock(mutex);
+        retired.addTo(total);
+        for (const ThreadBlock* block : live) block->addTo(total);
+        counters = counterNames;
+        histograms = histogramNames;
+    }
+};
+
+// Never destroyed, so threads and atexit handlers can still use it during shutdown
+inline Registry& registry() {
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+inline thread_local ThreadBlock* currentBlock = nullptr;
+
+// Hands the thread's block back to the registry when the thread exits
+struct ThreadHandle {
+    ThreadBlock* block = nullptr;
+
+    ~ThreadHandle() {
+        if (block != nullptr) {
+            registry().retire(block);
+            delete block;
+            currentBlock = nullptr;
+        }
+    }
+};
+
+inline ThreadBlock& attachThread() {
+    static thread_local ThreadHandle handle;
+    handle.block = new ThreadBlock();
+    registry().attach(handle.block);
+    currentBlock = handle.block;
+    return *handle.block;
+}
+
+inline ThreadBlock& localBlock() {
+    ThreadBlock* block = currentBlock;
+    return (block != nullptr) ? *block : attachThread();
+}
+
+class Counter {
+private:
+    int id;
+
+public:
+    explicit Counter(const char* name) : id(registry().addCounter(name)) {}
+
+    void add(std::uint64_t n) { bump(localBlock().counters[id], n); }
+};
+
+class Histogram {
+private:
+    int id;
+
+public:
+    explicit Histogram(const char* name) : id(registry().addHistogram(name)) {}
+
+    void record(std::uint64_t value) {
+        HistogramSlots& h = localBlock().histograms[id];
+        bump(h.buckets[bucketIndex(value)], 1);
+        bump(h.count, 1);
+        bump(h.sum, value);
+        if (value > h.max.load(std::memory_order_relaxed)) h.max.store(value, std::memory_order_relaxed);
+    }
+};
+
+// Records the time from construction to destruction into a histogram
+class ScopedTimer {
+private:
+    Histogram& histogram;
+    std::uint64_t start;
+
+public:
+    explicit ScopedTimer(Histogram& histogram) : histogram(histogram), start(ticks()) {}
+    ~ScopedTimer() { histogram.record(ticks() - start); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+// Value below which 'quantile' of the recorded samples fall (bucket lower bound)
+inline std::uint64_t quantile(const HistogramSlots& h, double q) {
+    std::uint64_t count = h.count.load(std::memory_order_relaxed);
+    if (count == 0) return 0;
+    std::uint64_t rank = static_cast<std::uint64_t>(q * static_cast<double>(count - 1)) + 1;
+    std::uint64_t seen = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+        seen += h.buckets[b].load(std::memory_order_relaxed);
+        if (seen >= rank) return bucketLowerBound(b);
+    }
+    return h.max.load(std::memory_order_relaxed);
+}
+
+// Writes every counter and histogram as JSON; histogram values are in nanoseconds
+inline bool writeSnapshot(const char* path) {
+    Registry& r = registry();
+    ThreadBlock* total = new ThreadBlock();
+    std::vector<std::string> counterNames, histogramNames;
+    r.collect(*total, counterNames, histogramNames);
+    double nsPerTick = 1.0 / r.ticksPerNs();
+
+    std::FILE* output = std::fopen(path, "w");
+    if (output == nullptr) {
+        delete total;
+        return false;
+    }
+    std::fprintf(output, "{\n  \"schema\": 1,\n  \"counters\": {");
+    for (std::size_t i = 0; i < counterNames.size() && i < static_cast<std::size_t>(MAX_COUNTERS); i++) {
+        std::fprintf(output, "%s\n    \"%s\": %llu", i == 0 ? "" : ",", counterNames[i].c_str(),
+                     static_cast<unsigned long long>(total->counters[i].load(std::memory_order_relaxed)));
+    }
+    std::fprintf(output, "\n  },\n  \"histograms\": {");
+    for (std::size_t i = 0; i < histogramNames.size() && i < static_cast<std::size_t>(MAX_HISTOGRAMS); i++) {
+        const HistogramSlots& h = total->histograms[i];
+        std::uint64_t count = h.count.load(std::memory_order_relaxed);
+        double mean = count > 0 ? static_cast<double>(h.sum.load(std::memory_order_relaxed)) / count : 0;
+        std::fprintf(output,
+                     "%s\n    \"%s\": {\"count\": %llu, \"mean_ns\": %.1f, \"p50_ns\": %.1f, \"p90_ns\": %.1f, "
+                     "\"p99_ns\": %.1f, \"max_ns\": %.1f, \"buckets\": [",
+                     i == 0 ? "" : ",", histogramNames[i].c_str(), static_cast<unsigned long long>(count),
+                     mean * nsPerTick, quantile(h, 0.5) * nsPerTick, quantile(h, 0.9) * nsPerTick,
+                     quantile(h, 0.99) * nsPerTick, h.max.load(std::memory_order_relaxed) * nsPerTick);
+        // Non-empty buckets only, as [lower bound in ns, samples]
+        bool first = true;
+        for (int b = 0; b < BUCKETS; b++) {
+            std::uint64_t samples = h.buckets[b].load(std::memory_order_relaxed);
+            if (samples == 0) continue;
+            std::fprintf(output, "%s[%.1f, %llu]", first ? "" : ", ", bucketLowerBound(b) * nsPerTick,
+                         static_cast<unsigned long long>(samples));
+            first = false;
+        }
+        std::fprintf(output, "]}");
+    }
+    std::fprintf(output, "\n  }\n}\n");
+    delete total;
+    bool failed = std::ferror(output) != 0;
+    return (std::fclose(output) == 0) && !failed;
+}
+
+inline bool dump() {
+    const std::string& path = registry().dumpPath;
+    return !path.empty() && writeSnapshot(path.c_str());
+}
+
+#ifndef _WIN32
+// The signal handler only writes a byte to a pipe; a background thread does
+// the actual dump, outside of signal context
+inline int& dumpPipeWriteEnd() {
+    static int fd = -1;
+    return fd;
+}
+
+inline void onDumpSignal(int) {
+    int savedErrno = errno;
+    char byte = 1;
+    if (write(dumpPipeWriteEnd(), &byte, 1) < 0) {
+        // Pipe full: a dump is already pending
+    }
+    errno = savedErrno;
+}
+#endif
+
+// Sets the dump path (METRICS_FILE overrides 'defaultPath'), dumps on
+// SIGUSR1, and at exit as well when METRICS_FILE is set
+inline void init(const char* defaultPath) {
+    const char* fromEnv = std::getenv("METRICS_FILE");
+    registry().dumpPath = (fromEnv != nullptr && *fromEnv != '\0') ? fromEnv : defaultPath;
+    if (fromEnv != nullptr && *fromEnv != '\0') {
+        std::atexit([]() { dump(); });
+    }
+
+#ifndef _WIN32
+    int fds[2];
+    if (pipe(fds) != 0) return;
+    fcntl(fds[1], F_SETFL, O_NONBLOCK); // never block inside the handler
+    dumpPipeWriteEnd() = fds[1];
+    std::thread([readEnd = fds[0]]() {
+        char byte;
+        for (;;) {
+            ssize_t n = read(readEnd, &byte, 1);
+            if (n > 0) {
+                dump();
+            } else if (n < 0 && errno == EINTR) {
+                continue;
+            } else {
+                break;
+            }
+        }
+    }).detach();
+
+    struct sigaction action = {};
+    action.sa_handler = onDumpSignal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGUSR1, &action, nullptr);
+#endif
+}
+
+} // namespace metrics
+
+#define METRICS_CONCAT_INNER(a, b) a##b
+#define METRICS_CONCAT(a, b) METRICS_CONCAT_INNER(a, b)
+
+#define METRICS_COUNTER(var, name) static ::metrics::Counter var(name)
+#define METRICS_HISTOGRAM(var, name) static ::metrics::Histogram var(name)
+#define METRICS_INC(counter) (counter).add(1)
+#define METRICS_ADD(counter, n) (counter).add(n)
+#define METRICS_TIME(histogram) ::metrics::ScopedTimer METRICS_CONCAT(metricsTimer, __LINE__)(histogram)
+#define METRICS_INIT(defaultPath) ::metrics::init(defaultPath)
+#define METRICS_DUMP() ::metrics::dump()
+
+#else
+
+#define METRICS_COUNTER(var, name) static_assert(true, "")
+#define METRICS_HISTOGRAM(var, name) static_assert(true, "")
+#define METRICS_INC(counter) ((void)0)
+#define METRICS_ADD(counter, n) ((void)0)
+#define METRICS_TIME(histogram) ((void)0)
+#define METRICS_INIT(defaultPath) ((void)0)
+#define METRICS_DUMP() false
+
+#endif
+
+#endif
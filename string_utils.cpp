@@ -0,0 +1,535 @@
+///String Manipulation core
+#include "string_utils.h"
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define STRING_KERNELS_X86 1
+#endif
+
+static bool isAsciiScalar(const char* str, std::size_t len) {
+    for (std::size_t i = 0; i < len; i++) {
+        if (static_cast<unsigned char>(str[i]) & 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#ifdef STRING_KERNELS_X86
+// SSE2 kernels (16-byte blocks). SSE2 has no byte shuffle, so a block is
+// reversed by reversing dwords, then words, then swapping the bytes in each word.
+__attribute__((target("sse2")))
+static inline __m128i reverseBytesSSE2(__m128i v) {
+    v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+__attribute__((target("sse2")))
+static void reverseSSE2(char* str, std::size_t len) {
+    char* start = str;
+    char* end = str + len; // one past the last character
+
+    // Swap a block from each end until fewer than two blocks remain in the middle
+    while (end - start >= 32) {
+        __m128i front = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+        __m128i back = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end - 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(start), reverseBytesSSE2(back));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(end - 16), reverseBytesSSE2(front));
+        start += 16;
+        end -= 16;
+    }
+    reverseScalar(start, static_cast<std::size_t>(end - start));
+}
+
+__attribute__((target("sse2")))
+static std::size_t countVowelsSSE2(const char* str, std::size_t len) {
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i a = _mm_set1_epi8('a');
+    const __m128i e = _mm_set1_epi8('e');
+    const __m128i i = _mm_set1_epi8('i');
+    const __m128i o = _mm_set1_epi8('o');
+    const __m128i u = _mm_set1_epi8('u');
+
+    std::size_t count = 0;
+    std::size_t pos = 0;
+    for (; pos + 16 <= len; pos += 16) {
+        __m128i v = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos)), caseBit);
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, a), _mm_cmpeq_epi8(v, e)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, i), _mm_cmpeq_epi8(v, o)));
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(v, u));
+        count += static_cast<std::size_t>(__builtin_popcount(_mm_movemask_epi8(hits)));
+    }
+    return count + countVowelsScalar(str + pos, len - pos);
+}
+
+__attribute__((target("sse2")))
+static bool mirrorEqualSSE2(const char* front, const char* backEnd, std::size_t n) {
+    // Compare the front block against the mirrored back block
+    for (; n >= 16; n -= 16) {
+        __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(front));
+        __m128i b = reverseBytesSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(backEnd - 16)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(f, b)) != 0xFFFF) {
+            return false;
+        }
+        front += 16;
+        backEnd -= 16;
+    }
+    return mirrorEqualScalar(front, backEnd, n);
+}
+
+__attribute__((target("sse2")))
+static bool isAsciiSSE2(const char* str, std::size_t len) {
+    __m128i bits = _mm_setzero_si128();
+    std::size_t pos = 0;
+    for (; pos + 16 <= len; pos += 16) {
+        bits = _mm_or_si128(bits, _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + pos)));
+    }
+    return _mm_movemask_epi8(bits) == 0 && isAsciiScalar(str + pos, len - pos);
+}
+
+// AVX2 kernels (32-byte blocks). The byte shuffle only works within 128-bit
+// lanes, so each lane is reversed and then the two lanes are swapped.
+// Tails go to the SSE2 kernels, which are legacy-SSE encoded, so the upper
+// ymm state is cleared first to avoid the AVX-to-SSE transition penalty.
+__attribute__((target("avx2")))
+static inline __m256i reverseBytesAVX2(__m256i v) {
+    const __m256i mask = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    v = _mm256_shuffle_epi8(v, mask);
+    return _mm256_permute2x128_si256(v, v, 0x01);
+}
+
+__attribute__((target("avx2")))
+static void reverseAVX2(char* str, std::size_t len) {
+    char* start = str;
+    char* end = str + len;
+
+    while (end - start >= 64) {
+        __m256i front = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start));
+        __m256i back = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(end - 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(start), reverseBytesAVX2(back));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(end - 32), reverseBytesAVX2(front));
+        start += 32;
+        end -= 32;
+    }
+    _mm256_zeroupper();
+    reverseSSE2(start, static_cast<std::size_t>(end - start));
+}
+
+__attribute__((target("avx2,popcnt")))
+static std::size_t countVowelsAVX2(const char* str, std::size_t len) {
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+    const __m256i a = _mm256_set1_epi8('a');
+    const __m256i e = _mm256_set1_epi8('e');
+    const __m256i i = _mm256_set1_epi8('i');
+    const __m256i o = _mm256_set1_epi8('o');
+    const __m256i u = _mm256_set1_epi8('u');
+
+    std::size_t count = 0;
+    std::size_t pos = 0;
+    for (; pos + 32 <= len; pos += 32) {
+        __m256i v = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos)), caseBit);
+        __m256i hits = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, a), _mm256_cmpeq_epi8(v, e)),
+                                       _mm256_or_si256(_mm256_cmpeq_epi8(v, i), _mm256_cmpeq_epi8(v, o)));
+        hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(v, u));
+        count += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(hits))));
+    }
+    _mm256_zeroupper();
+    return count + countVowelsSSE2(str + pos, len - pos);
+}
+
+__attribute__((target("avx2")))
+static bool mirrorEqualAVX2(const char* front, const char* backEnd, std::size_t n) {
+    for (; n >= 32; n -= 32) {
+        __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(front));
+        __m256i b = reverseBytesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(backEnd - 32)));
+        if (static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(f, b))) != 0xFFFFFFFFu) {
+            return false;
+        }
+        front += 32;
+        backEnd -= 32;
+    }
+    _mm256_zeroupper();
+    return mirrorEqualSSE2(front, backEnd, n);
+}
+
+__attribute__((target("avx2")))
+static bool isAsciiAVX2(const char* str, std::size_t len) {
+    __m256i bits = _mm256_setzero_si256();
+    std::size_t pos = 0;
+    for (; pos + 32 <= len; pos += 32) {
+        bits = _mm256_or_si256(bits, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + pos)));
+    }
+    bool ascii = _mm256_movemask_epi8(bits) == 0;
+    _mm256_zeroupper();
+    return ascii && isAsciiSSE2(str + pos, len - pos);
+}
+#endif
+
+static const StringKernels scalarKernels = {"scalar", reverseScalar, countVowelsScalar, mirrorEqualScalar, isAsciiScalar};
+#ifdef STRING_KERNELS_X86
+static const StringKernels sse2Kernels = {"sse2", reverseSSE2, countVowelsSSE2, mirrorEqualSSE2, isAsciiSSE2};
+static const StringKernels avx2Kernels = {"avx2", reverseAVX2, countVowelsAVX2, mirrorEqualAVX2, isAsciiAVX2};
+#endif
+
+static const StringKernels& selectKernels() {
+#ifdef STRING_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return avx2Kernels;
+    if (__builtin_cpu_supports("sse2")) return sse2Kernels;
+#endif
+    return scalarKernels;
+}
+
+// Selected on first use, so callers in other translation units' static
+// initializers still see a valid table
+const StringKernels& stringKernels() {
+    static const StringKernels& kernels = selectKernels();
+    return kernels;
+}
+
+const StringKernels& scalarStringKernels() {
+    return scalarKernels;
+}
+
+// NUL-terminated API, kept for existing callers
+char* reverseString(char* str) {
+    if (str == nullptr) return nullptr;
+
+    return reverseString(str, std::strlen(str));
+}
+
+int countingVowels(const char* str) {
+    if (str == nullptr) return 0;
+
+    return static_cast<int>(countingVowels(std::string_view(str)));
+}
+
+bool isPalindrome(const char* str) {
+    if (str == nullptr) return false;
+
+    return isPalindrome(std::string_view(str));
+}
+
+// UTF-8 helpers
+const std::size_t UTF8_BLOCK = 256;
+// Vowel counting first tries runs this long, small enough to still be in L1
+// when the count kernel reads them right after the ASCII check
+const std::size_t UTF8_ASCII_RUN = 16384;
+const char32_t REPLACEMENT_CHAR = 0xFFFD;
+
+static char32_t decodeUtf8Forward(const char*& pos, const char* end) {
+    unsigned char lead = static_cast<unsigned char>(*pos);
+    if (lead < 0x80) {
+        pos++;
+        return lead;
+    }
+
+    int extra;
+    char32_t ch;
+    if ((lead & 0xE0) == 0xC0) {
+        extra = 1;
+        ch = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        extra = 2;
+        ch = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        extra = 3;
+        ch = lead & 0x07;
+    } else {
+        pos++;
+        return REPLACEMENT_CHAR;
+    }
+
+    if (end - pos <= extra) {
+        pos++;
+        return REPLACEMENT_CHAR;
+    }
+    for (int i = 1; i <= extra; i++) {
+        unsigned char next = static_cast<unsigned char>(pos[i]);
+        if ((next & 0xC0) != 0x80) {
+            pos++;
+            return REPLACEMENT_CHAR;
+        }
+        ch = (ch << 6) | (next & 0x3F);
+    }
+
+    // Overlong forms, UTF-16 surrogates and values past U+10FFFF are malformed
+    // too; like any other bad lead, only the lead byte is consumed
+    static const char32_t minValue[] = {0, 0x80, 0x800, 0x10000};
+    if (ch < minValue[extra] || (ch >= 0xD800 && ch <= 0xDFFF) || ch > 0x10FFFF) {
+        pos++;
+        return REPLACEMENT_CHAR;
+    }
+    pos += extra + 1;
+    return ch;
+}
+
+// Decodes the code point that ends just before 'pos' and moves 'pos' to its start
+static char32_t decodeUtf8Backward(const char*& pos, const char* begin) {
+    const char* lead = pos - 1;
+    while (lead > begin && pos - lead < 4 && (static_cast<unsigned char>(*lead) & 0xC0) == 0x80) {
+        lead--;
+    }
+
+    const char* next = lead;
+    char32_t ch = decodeUtf8Forward(next, pos);
+    if (next == pos) {
+        pos = lead;
+        return ch;
+    }
+    pos--;
+    return REPLACEMENT_CHAR;
+}
+
+// Simple case folding for ASCII, Latin-1, Latin Extended-A, Greek and Cyrillic
+static char32_t foldCase(char32_t ch) {
+    if (ch >= 'A' && ch <= 'Z') return ch + 32;
+    if (ch < 0xC0) return ch;
+    if (ch <= 0xDE) return (ch == 0xD7) ? ch : ch + 32;
+    if ((ch >= 0x100 && ch <= 0x12F) || (ch >= 0x132 && ch <= 0x137) || (ch >= 0x14A && ch <= 0x177)) {
+        return ch | 1;
+    }
+    if ((ch >= 0x139 && ch <= 0x148) || (ch >= 0x179 && ch <= 0x17E)) {
+        return (ch & 1) ? ch + 1 : ch;
+    }
+    if (ch == 0x178) return 0xFF;
+    if ((ch >= 0x391 && ch <= 0x3A9) && ch != 0x3A2) return ch + 32;
+    if (ch == 0x3C2) return 0x3C3; // final sigma
+    if (ch >= 0x400 && ch <= 0x40F) return ch + 80;
+    if (ch >= 0x410 && ch <= 0x42F) return ch + 32;
+    return ch;
+}
+
+// ASCII punctuation/whitespace plus the common Unicode punctuation, space,
+// currency, arrow/symbol and emoji blocks
+static bool isPunctuationOrSpace(char32_t ch) {
+    if (ch < 0x80) {
+        return !((ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'));
+    }
+    return (ch >= 0xA0 && ch <= 0xBF) || ch == 0xD7 || ch == 0xF7 || (ch >= 0x2000 && ch <= 0x206F) ||
+           (ch >= 0x20A0 && ch <= 0x20CF) || (ch >= 0x2190 && ch <= 0x2BFF) || (ch >= 0x3000 && ch <= 0x303F) ||
+           (ch >= 0xFF01 && ch <= 0xFF0F) || (ch >= 0x1F000 && ch <= 0x1FAFF);
+}
+
+VowelSet::VowelSet(std::string_view chars) : ascii(), defaultSet(false) {
+    const char* pos = chars.data();
+    const char* end = pos + chars.size();
+    while (pos < end) {
+        char32_t ch = decodeUtf8Forward(pos, end);
+        if (ch < 0x80) {
+            ascii[ch] = true;
+        } else {
+            others.push_back(ch);
+        }
+    }
+    std::sort(others.begin(), others.end());
+
+    // The byte kernels hard-code exactly these ten letters
+    defaultSet = true;
+    for (int ch = 0; ch < 128; ch++) {
+        bool expected = isVowel(static_cast<char>(ch));
+        if (ascii[ch] != expected) defaultSet = false;
+    }
+}
+
+std::size_t VowelSet::countAscii(const char* str, std::size_t len) const {
+    if (defaultSet) return stringKernels().countVowels(str, len);
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < len; i++) {
+        count += ascii[static_cast<unsigned char>(str[i])];
+    }
+    return count;
+}
+
+std::size_t countingVowelsUtf8(std::string_view str, const VowelSet& vowels) {
+    const StringKernels& kernels = stringKernels();
+    const char* pos = str.data();
+    const char* end = pos + str.size();
+    std::size_t count = 0;
+
+    while (pos < end) {
+        std::size_t run = std::min(UTF8_ASCII_RUN, static_cast<std::size_t>(end - pos));
+        if (kernels.isAscii(pos, run)) {
+            count += vowels.countAscii(pos, run);
+            pos += run;
+            continue;
+        }
+
+        // Mixed run: go block by block so its ASCII stretches still use the kernels
+        const char* runEnd = pos + run;
+        while (pos < runEnd) {
+            std::size_t n = std::min(UTF8_BLOCK, static_cast<std::size_t>(runEnd - pos));
+            if (kernels.isAscii(pos, n)) {
+                count += vowels.countAscii(pos, n);
+                pos += n;
+                continue;
+            }
+            // A sequence may straddle the block edge; decoding simply runs past it
+            const char* stop = pos + n;
+            while (pos < stop) {
+                count += vowels.contains(decodeUtf8Forward(pos, end));
+            }
+        }
+    }
+    return count;
+}
+
+std::size_t countingVowelsUtf8(std::string_view str) {
+    static const VowelSet defaultVowels;
+    return countingVowelsUtf8(str, defaultVowels);
+}
+
+// Reverses by code point: reverse the bytes, then flip every multi-byte
+// sequence (now continuation bytes followed by their lead byte) back in order
+char* reverseStringUtf8(char* str, std::size_t len) {
+    if (str == nullptr) return nullptr;
+
+    stringKernels().reverse(str, len);
+
+    std::size_t pos = 0;
+    while (pos < len) {
+        std::size_t n = std::min(UTF8_BLOCK, len - pos);
+        if (stringKernels().isAscii(str + pos, n)) {
+            pos += n;
+            continue;
+        }
+        std::size_t stop = pos + n;
+        while (pos < stop) {
+            if ((static_cast<unsigned char>(str[pos]) & 0xC0) != 0x80) {
+                pos++;
+                continue;
+            }
+            std::size_t lead = pos;
+            while (lead < len && lead - pos < 3 && (static_cast<unsigned char>(str[lead]) & 0xC0) == 0x80) {
+                lead++;
+            }
+            if (lead < len && static_cast<unsigned char>(str[lead]) >= 0xC0) {
+                reverseScalar(str + pos, lead - pos + 1);
+                pos = lead + 1;
+            } else {
+                pos = lead; // stray continuation bytes stay where they are
+            }
+        }
+    }
+    return str;
+}
+
+char* reverseStringUtf8(char* str) {
+    if (str == nullptr) return nullptr;
+
+    return reverseStringUtf8(str, std::strlen(str));
+}
+
+// How each ASCII character takes part in a loose palindrome comparison: the
+// low 7 bits are what it compares as and KEEP_ASCII is set unless it is
+// skipped. One table per combination of options.
+const unsigned char KEEP_ASCII = 0x80;
+
+static const unsigned char* asciiNormalization(PalindromeOptions options) {
+    static const struct Tables {
+        unsigned char byOptions[4][128];
+
+        Tables() {
+            for (int index = 0; index < 4; index++) {
+                for (int ch = 0; ch < 128; ch++) {
+                    bool letter = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+                    bool alnum = letter || (ch >= '0' && ch <= '9');
+                    int folded = ((index & 1) && letter) ? (ch | 0x20) : ch;
+                    bool keep = !(index & 2) || alnum;
+                    byOptions[index][ch] = static_cast<unsigned char>(folded | (keep ? KEEP_ASCII : 0));
+                }
+            }
+        }
+    } tables;
+    return tables.byOptions[(options.foldCase ? 1 : 0) | (options.skipPunctuation ? 2 : 0)];
+}
+
+// Writes the characters of an ASCII block that take part in the comparison
+// to 'out', normalized, and returns how many there are. Branch-free, since
+// punctuation falls at random and a branch on it would mispredict.
+static std::size_t normalizeAsciiBlock(const char* str, std::size_t n, const unsigned char* table, char* out) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        unsigned char entry = table[static_cast<unsigned char>(str[i])];
+        out[kept] = static_cast<char>(entry & 0x7F);
+        kept += entry >> 7;
+    }
+    return kept;
+}
+
+// Offset of the index-th character of an ASCII block that takes part in the
+// comparison; only needed when the two ends of a block pair keep different counts
+static std::size_t keptOffset(const char* str, const unsigned char* table, std::size_t index) {
+    for (std::size_t i = 0;; i++) {
+        if (table[static_cast<unsigned char>(str[i])] & KEEP_ASCII) {
+            if (index == 0) return i;
+            index--;
+        }
+    }
+}
+
+bool isPalindromeUtf8(std::string_view str, PalindromeOptions options) {
+    const char* front = str.data();
+    const char* back = front + str.size();
+    bool bytewise = !options.foldCase && !options.skipPunctuation;
+    const char* slowUntil = front;
+    const unsigned char* table = asciiNormalization(options);
+    char frontKept[UTF8_BLOCK];
+    char backKept[UTF8_BLOCK];
+
+    while (front < back) {
+        // Mirrored ASCII blocks at both ends compare byte for byte, after
+        // folding and dropping punctuation if the options ask for it
+        if (front >= slowUntil) {
+            std::size_t n = std::min(UTF8_BLOCK, static_cast<std::size_t>(back - front) / 2);
+            if (n > 0 && stringKernels().isAscii(front, n) && stringKernels().isAscii(back - n, n)) {
+                if (bytewise) {
+                    if (!stringKernels().mirrorEqual(front, back, n)) return false;
+                    front += n;
+                    back -= n;
+                    continue;
+                }
+
+                // The two blocks may keep different numbers of characters;
+                // compare what both have and advance each end past its share
+                std::size_t frontCount = normalizeAsciiBlock(front, n, table, frontKept);
+                std::size_t backCount = normalizeAsciiBlock(back - n, n, table, backKept);
+                std::size_t m = std::min(frontCount, backCount);
+                if (!stringKernels().mirrorEqual(frontKept, backKept + backCount, m)) return false;
+                const char* backBlock = back - n;
+                front = (m == frontCount) ? front + n : front + keptOffset(front, table, m);
+                back = (m == backCount) ? backBlock : backBlock + keptOffset(backBlock, table, backCount - m - 1) + 1;
+                continue;
+            }
+            slowUntil = front + n;
+        }
+
+        const char* nextFront = front;
+        char32_t first = decodeUtf8Forward(nextFront, back);
+        if (options.skipPunctuation && isPunctuationOrSpace(first)) {
+            front = nextFront;
+            continue;
+        }
+        const char* nextBack = back;
+        char32_t last = decodeUtf8Backward(nextBack, front);
+        if (options.skipPunctuation && isPunctuationOrSpace(last)) {
+            back = nextBack;
+            continue;
+        }
+        if (nextFront > nextBack) break; // both ends reached the middle code point
+
+        if (options.foldCase) {
+            first = foldCase(first);
+            last = foldCase(last);
+        }
+        if (first != last) return false;
+        front = nextFront;
+        back = nextBack;
+    }
+    return true;
+}
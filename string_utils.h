@@ -0,0 +1,167 @@
+///String Manipulation core: byte kernels with run-time SIMD dispatch, the
+///length-aware and NUL-terminated APIs, and the UTF-8 variants
+#ifndef STRING_UTILS_H
+#define STRING_UTILS_H
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+
+// The length-aware overloads can only be constexpr when the compiler lets them
+// fall back to the scalar kernels during constant evaluation (C++20).
+#ifdef __cpp_lib_is_constant_evaluated
+#define STRING_UTILS_CONSTEXPR constexpr
+#else
+#define STRING_UTILS_CONSTEXPR inline
+#endif
+
+// Scalar kernels: the byte-at-a-time reference versions, also used for the
+// tails that are shorter than one vector block.
+constexpr void reverseScalar(char* str, std::size_t len) {
+    if (len < 2) return;
+
+    char* start = str;
+    char* end = str + len - 1;
+
+    // Swap characters from start and end until they meet in the middle
+    while (start < end) {
+        char temp = *start;
+        *start = *end;
+        *end = temp;
+        start++;
+        end--;
+    }
+}
+
+constexpr bool isVowel(char ch) {
+    // Setting bit 0x20 maps 'A'..'Z' onto 'a'..'z' and leaves the lowercase vowels alone
+    char lower = static_cast<char>(ch | 0x20);
+    return lower == 'a' || lower == 'e' || lower == 'i' || lower == 'o' || lower == 'u';
+}
+
+constexpr std::size_t countVowelsScalar(const char* str, std::size_t len) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < len; i++) {
+        count += isVowel(str[i]);
+    }
+    return count;
+}
+
+// Palindrome kernels compare a front range against a back range read
+// backwards: front[i] == backEnd[-1 - i]. A whole string is the special case
+// isPalindrome(str, len) == mirrorEqual(str, str + len, len / 2), and large
+// files use it to check mirrored chunks from both ends independently.
+constexpr bool mirrorEqualScalar(const char* front, const char* backEnd, std::size_t n) {
+    // Compare characters from start and end until they meet in the middle
+    for (std::size_t i = 0; i < n; i++) {
+        if (front[i] != backEnd[-1 - static_cast<std::ptrdiff_t>(i)]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Kernel table, selected once at startup from the CPU's feature flags
+struct StringKernels {
+    const char* name;
+    void (*reverse)(char* str, std::size_t len);
+    std::size_t (*countVowels)(const char* str, std::size_t len);
+    bool (*mirrorEqual)(const char* front, const char* backEnd, std::size_t n);
+    bool (*isAscii)(const char* str, std::size_t len);
+};
+
+// The dispatched table, and the scalar one for comparisons
+const StringKernels& stringKernels();
+const StringKernels& scalarStringKernels();
+
+// Length-aware API: callers that already know the length skip the strlen scan,
+// and embedded NULs or non-terminated buffers are handled correctly
+STRING_UTILS_CONSTEXPR char* reverseString(char* str, std::size_t len) {
+    if (str == nullptr) return nullptr;
+
+#ifdef __cpp_lib_is_constant_evaluated
+    if (std::is_constant_evaluated()) {
+        reverseScalar(str, len);
+        return str;
+    }
+#endif
+    stringKernels().reverse(str, len);
+    return str;
+}
+
+STRING_UTILS_CONSTEXPR std::size_t countingVowels(std::string_view str) {
+#ifdef __cpp_lib_is_constant_evaluated
+    if (std::is_constant_evaluated()) return countVowelsScalar(str.data(), str.size());
+#endif
+    return stringKernels().countVowels(str.data(), str.size());
+}
+
+STRING_UTILS_CONSTEXPR std::size_t countingVowels(const char* str, std::size_t len) {
+    if (str == nullptr) return 0;
+
+    return countingVowels(std::string_view(str, len));
+}
+
+STRING_UTILS_CONSTEXPR bool isPalindrome(std::string_view str) {
+#ifdef __cpp_lib_is_constant_evaluated
+    if (std::is_constant_evaluated()) return mirrorEqualScalar(str.data(), str.data() + str.size(), str.size() / 2);
+#endif
+    return stringKernels().mirrorEqual(str.data(), str.data() + str.size(), str.size() / 2);
+}
+
+STRING_UTILS_CONSTEXPR bool isPalindrome(const char* str, std::size_t len) {
+    if (str == nullptr) return false;
+
+    return isPalindrome(std::string_view(str, len));
+}
+
+#ifdef __cpp_lib_is_constant_evaluated
+static_assert(countingVowels(std::string_view("This is a test string.")) == 5);
+static_assert(isPalindrome(std::string_view("racecar")) && !isPalindrome(std::string_view("hello")));
+#endif
+
+// NUL-terminated API, kept for existing callers
+char* reverseString(char* str);
+int countingVowels(const char* str);
+bool isPalindrome(const char* str);
+
+// UTF-8 API. Input is scanned in blocks; a block that is pure ASCII goes
+// through the byte kernels above, anything else is walked code point by code
+// point. The decoder is lenient: a malformed byte reads as U+FFFD.
+
+// Set of characters counted as vowels, given as a UTF-8 string
+class VowelSet {
+private:
+    bool ascii[128];
+    std::vector<char32_t> others; // sorted non-ASCII code points
+    bool defaultSet;
+
+public:
+    explicit VowelSet(std::string_view chars = "aeiouAEIOU");
+
+    bool contains(char32_t ch) const {
+        if (ch < 0x80) return ascii[ch];
+        return std::binary_search(others.begin(), others.end(), ch);
+    }
+
+    std::size_t countAscii(const char* str, std::size_t len) const;
+};
+
+std::size_t countingVowelsUtf8(std::string_view str, const VowelSet& vowels);
+// Same, with the default vowels (built once, not per call)
+std::size_t countingVowelsUtf8(std::string_view str);
+
+// Reverses by code point, leaving each multi-byte sequence in order
+char* reverseStringUtf8(char* str, std::size_t len);
+char* reverseStringUtf8(char* str);
+
+struct PalindromeOptions {
+    bool foldCase = false;
+    bool skipPunctuation = false;
+};
+
+bool isPalindromeUtf8(std::string_view str, PalindromeOptions options = PalindromeOptions());
+
+#endif
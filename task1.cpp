@@ -1,30 +1,244 @@
 /// <task1: Basic Calculator>
 #include <iostream>
-/// @brief I assume that the operations are binary operations
-class BasicOperation {
-    public:
-    double arg1, arg2;
-    char op;
-    double result;
-    BasicOperation(double a, char op, double b): arg1(a), op(op) , arg2(b) {
-        switch(op) {
-            case '+': result = arg1 + arg2; break;
-            case '-': result = arg1 - arg2; break;
-            case '*': result = arg1 * arg2; break;
-            case '/': 
-                if(arg2 != 0) {
-                    result = arg1 / arg2; 
-                } else {
-                    throw std::runtime_error("Division by zero");
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "calculator.h"
+
+/// @brief Non-interactive mode: task1 --expr "<expression>" [name=value ...]
+int evaluateExpressionArgs(int argc, char* argv[]) {
+    try {
+        Expression expr(argv[2]);
+        std::vector<double> values(expr.variables().size(), 0.0);
+        std::vector<bool> bound(values.size(), false);
+
+        for (int i = 3; i < argc; i++) {
+            const char* eq = std::strchr(argv[i], '=');
+            if (eq == nullptr) {
+                throw std::runtime_error(std::string("Expected name=value, got \"") + argv[i] + "\"");
+            }
+            int slot = expr.variableIndex(std::string(argv[i], eq - argv[i]));
+            if (slot >= 0) {
+                values[slot] = std::strtod(eq + 1, nullptr);
+                bound[slot] = true;
+            }
+        }
+        for (std::size_t i = 0; i < bound.size(); i++) {
+            if (!bound[i]) {
+                throw std::runtime_error("No value given for variable '" + expr.variables()[i] + "'");
+            }
+        }
+
+        CalcResult result = expr.evaluate(values.data());
+        if (!result.ok()) {
+            throw std::runtime_error(errorMessage(result.error));
+        }
+        std::cout << "Result: " << result.value << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+/// @brief Throughput of one BasicOperation per element vs. the batch API
+int runBatchBenchmark(std::size_t n) {
+    std::vector<double> a(n), b(n), result(n);
+    std::vector<std::uint8_t> errors(n);
+    for (std::size_t i = 0; i < n; i++) {
+        a[i] = static_cast<double>(i % 1000) * 0.5;
+        b[i] = static_cast<double>(i % 97); // every 97th divisor is zero
+    }
+
+    auto seconds = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        try {
+            result[i] = BasicOperation(a[i], '/', b[i]).result;
+        } catch (const std::exception&) {
+            failed++;
+        }
+    }
+    double objectSeconds = seconds(start);
+
+    start = std::chrono::steady_clock::now();
+    std::size_t flagged = evaluateBatch('/', a.data(), b.data(), result.data(), errors.data(), n);
+    double batchSeconds = seconds(start);
+
+    Expression expr("(a+b)*a/b");
+    const double* columns[] = {a.data(), b.data()};
+    start = std::chrono::steady_clock::now();
+    std::size_t exprFlagged = expr.evaluateBatch(columns, result.data(), errors.data(), n);
+    double exprSeconds = seconds(start);
+
+    double millions = static_cast<double>(n) / 1e6;
+    std::cout << "Elements: " << n << " (" << failed << " / " << flagged << " / " << exprFlagged
+              << " divisions by zero)" << std::endl;
+    std::cout << "BasicOperation a/b:      " << millions / objectSeconds << " M/s" << std::endl;
+    std::cout << "evaluateBatch a/b:       " << millions / batchSeconds << " M/s" << std::endl;
+    std::cout << "Expression (a+b)*a/b:    " << millions / exprSeconds << " M/s" << std::endl;
+    return 0;
+}
+
+int runStreamMode(const char* inputPath, const char* outputPath, bool useIostream) {
+    auto start = std::chrono::steady_clock::now();
+    std::size_t lines = 0;
+    bool ok = true;
+
+    if (useIostream) {
+        // The interactive path's way of doing it: getline and operator>>
+        // extraction, one BasicOperation per line, exceptions for errors and
+        // endl after each result
+        std::ifstream file;
+        if (std::strcmp(inputPath, "-") != 0) file.open(inputPath);
+        std::istream& in = (std::strcmp(inputPath, "-") == 0) ? std::cin : file;
+        std::ofstream outFile;
+        if (std::strcmp(outputPath, "-") != 0) outFile.open(outputPath);
+        std::ostream& out = (std::strcmp(outputPath, "-") == 0) ? std::cout : outFile;
+        if (!in || !out) {
+            std::cerr << "Error: Could not open input or output file!" << std::endl;
+            return 1;
+        }
+
+        // Same line format and output as the batch path: the separators become
+        // spaces, blank lines are skipped, a line that doesn't parse gets an
+        // error, and results are printed with the shortest round-trip digits
+        std::string line;
+        while (std::getline(in, line)) {
+            for (char& ch : line) {
+                if (ch == ',' || ch == '\t' || ch == '\r') ch = ' ';
+            }
+            if (line.find_first_not_of(' ') == std::string::npos) continue;
+            lines++;
+
+            std::istringstream fields(line);
+            double num1, num2;
+            char op;
+            if (!(fields >> num1 >> op >> num2) || !(fields >> std::ws).eof()) {
+                out << "Error: Invalid input" << std::endl;
+                continue;
+            }
+            try {
+                BasicOperation calc(num1, op, num2);
+                char text[32];
+                *std::to_chars(text, text + sizeof(text) - 1, calc.result).ptr = '\0';
+                out << text << std::endl;
+            } catch (const std::exception& e) {
+                out << "Error: " << e.what() << std::endl;
+            }
+        }
+        ok = static_cast<bool>(out) && !in.bad();
+    } else {
+        std::FILE* input = (std::strcmp(inputPath, "-") == 0) ? stdin : std::fopen(inputPath, "rb");
+        std::FILE* output = (std::strcmp(outputPath, "-") == 0) ? stdout : std::fopen(outputPath, "wb");
+        if (input == nullptr || output == nullptr) {
+            std::cerr << "Error: Could not open input or output file!" << std::endl;
+            return 1;
+        }
+
+        StreamCalculator calculator(output);
+        ok = calculator.run(input);
+        lines = calculator.lineCount();
+        if (input != stdin) std::fclose(input);
+        ok = (output == stdout ? std::fflush(output) : std::fclose(output)) == 0 && ok;
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (!ok) {
+        std::cerr << "Error: Could not read input or write results!" << std::endl;
+        return 1;
+    }
+    std::cerr << "Lines: " << lines << " (" << (useIostream ? "iostream" : "from_chars + batch") << "), "
+              << lines / seconds << " lines/s" << std::endl;
+    return 0;
+}
+
+/// @brief Good- vs. bad-input throughput of the throwing, error-code and
+/// compile-time specialized division paths. Bad input has every other divisor zero.
+int runErrorPathBenchmark(std::size_t n) {
+    std::vector<double> a(n), good(n), bad(n);
+    std::vector<char> ops(n, '/');
+    for (std::size_t i = 0; i < n; i++) {
+        a[i] = static_cast<double>(i % 1000) + 0.5;
+        good[i] = static_cast<double>(i % 97 + 1);
+        bad[i] = (i % 2 == 0) ? 0.0 : good[i];
+    }
+
+    auto seconds = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    volatile double sink = 0;
+
+    std::cout << "variant,good_mops,bad_mops" << std::endl;
+    for (int variant = 0; variant < 3; variant++) {
+        double rates[2];
+        const std::vector<double>* inputs[] = {&good, &bad};
+        for (int k = 0; k < 2; k++) {
+            const std::vector<double>& b = *inputs[k];
+            double sum = 0;
+            std::size_t failed = 0;
+
+            auto start = std::chrono::steady_clock::now();
+            if (variant == 0) {
+                for (std::size_t i = 0; i < n; i++) {
+                    try {
+                        sum += BasicOperation(a[i], ops[i], b[i]).result;
+                    } catch (const std::runtime_error&) {
+                        failed++;
+                    }
+                }
+            } else if (variant == 1) {
+                for (std::size_t i = 0; i < n; i++) {
+                    CalcResult r = calculate(a[i], ops[i], b[i]);
+                    sum += r.value;
+                    failed += !r.ok();
                 }
-                break;
-            default:
-                throw std::runtime_error("Invalid operator");
+            } else {
+                for (std::size_t i = 0; i < n; i++) {
+                    CalcResult r = calculate<'/'>(a[i], b[i]);
+                    sum += r.value;
+                    failed += !r.ok();
+                }
+            }
+            rates[k] = static_cast<double>(n) / 1e6 / seconds(start);
+            sink = sink + sum + static_cast<double>(failed);
         }
+
+        const char* names[] = {"throw", "error_code", "specialized"};
+        std::cout << names[variant] << "," << rates[0] << "," << rates[1] << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 2 && std::strcmp(argv[1], "--expr") == 0) {
+        return evaluateExpressionArgs(argc, argv);
+    }
+    if (argc > 1 && std::strcmp(argv[1], "--bench-errors") == 0) {
+        std::size_t n = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::size_t(1) << 22;
+        return runErrorPathBenchmark(n);
+    }
+    if (argc > 1 && std::strcmp(argv[1], "--bench-batch") == 0) {
+        std::size_t n = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : std::size_t(1) << 24;
+        return runBatchBenchmark(n);
+    }
+    if (argc > 2 && (std::strcmp(argv[1], "--stream") == 0 || std::strcmp(argv[1], "--stream-iostream") == 0)) {
+        const char* outputPath = (argc > 3) ? argv[3] : "-";
+        return runStreamMode(argv[2], outputPath, std::strcmp(argv[1], "--stream-iostream") == 0);
     }
 
-};
-int main() {
     char continueChoice;
     
     do {
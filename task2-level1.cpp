@@ -2,8 +2,597 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <charconv>
+#include <csignal>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "guessing_game.h"
+
+// Simulator: every thread plays its share of games with its own guesser and
+// PRNG, filling a private attempt histogram that is merged at the end
+int runSimulation(const std::string& strategy, std::uint64_t games, std::uint64_t low, std::uint64_t high,
+                  unsigned threadCount) {
+    const int MAX_ATTEMPTS = 1000;
+    if (threadCount == 0) threadCount = 1;
+    if (low > high) {
+        std::cerr << "Error: Range low must not exceed high!" << std::endl;
+        return 1;
+    }
+    if (makeGuesser(strategy, 0) == nullptr) {
+        std::cerr << "Error: Unknown strategy '" << strategy << "' (binary, random, interpolation)" << std::endl;
+        return 1;
+    }
+
+    std::uint64_t seed = static_cast<std::uint64_t>(std::time(nullptr));
+    std::vector<std::vector<std::uint64_t>> histograms(threadCount, std::vector<std::uint64_t>(MAX_ATTEMPTS + 1, 0));
+    std::vector<std::thread> workers;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threadCount; t++) {
+        std::uint64_t share = games / threadCount + (t < games % threadCount ? 1 : 0);
+        workers.emplace_back([&, t, share]() {
+            FastRandom rng(seed * 1000003 + t);
+            std::unique_ptr<Guesser> guesser = makeGuesser(strategy, rng.next());
+            std::vector<std::uint64_t>& histogram = histograms[t];
+            for (std::uint64_t g = 0; g < share; g++) {
+                histogram[playGame(*guesser, rng.between(low, high), low, high, MAX_ATTEMPTS)]++;
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<std::uint64_t> total(MAX_ATTEMPTS + 1, 0);
+    for (const std::vector<std::uint64_t>& histogram : histograms) {
+        for (int i = 0; i <= MAX_ATTEMPTS; i++) total[i] += histogram[i];
+    }
+
+    double sum = 0;
+    int maxSeen = 0;
+    for (int i = 1; i <= MAX_ATTEMPTS; i++) {
+        sum += static_cast<double>(total[i]) * i;
+        if (total[i] > 0) maxSeen = i;
+    }
+    std::uint64_t finished = games - total[0];
+
+    std::cout << "Strategy: " << strategy << ", range " << low << "-" << high << ", " << threadCount << " threads" << std::endl;
+    std::cout << "Games: " << games << " in " << seconds << " s (" << games / seconds << " games/s)" << std::endl;
+    std::cout << "Average attempts: " << (finished > 0 ? sum / finished : 0) << ", max: " << maxSeen << std::endl;
+    if (total[0] > 0) {
+        std::cout << "Gave up after " << MAX_ATTEMPTS << " attempts: " << total[0] << std::endl;
+    }
+    std::cout << "attempts,games" << std::endl;
+    for (int i = 1; i <= maxSeen; i++) {
+        if (total[i] > 0) std::cout << i << "," << total[i] << std::endl;
+    }
+    return 0;
+}
+
+#ifdef __linux__
+// Game server: one session per connection, all driven by a single epoll loop.
+// Protocol (one line each way):
+//   server -> "READY <low> <high>"   on connect and after "NEW"
+//   client -> "<guess>"              server -> "LOW", "HIGH" or "CORRECT <attempts>"
+//   after CORRECT a new target is drawn and the next guess starts a new game.
+// Anything else gets "ERROR". Addresses are a TCP port on 127.0.0.1 when all
+// digits, otherwise a Unix socket path.
+
+static volatile std::sig_atomic_t stopRequested = 0;
+
+static void requestStop(int) {
+    stopRequested = 1;
+}
+
+static std::uint64_t nowNanos() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static bool isPort(const char* address) {
+    for (const char* p = address; *p != '\0'; p++) {
+        if (*p < '0' || *p > '9') return false;
+    }
+    return *address != '\0';
+}
+
+// Fills in a sockaddr for 'address'; returns its length, or 0 if the path is too long
+static socklen_t makeAddress(const char* address, sockaddr_storage& storage) {
+    std::memset(&storage, 0, sizeof(storage));
+    if (isPort(address)) {
+        sockaddr_in* in = reinterpret_cast<sockaddr_in*>(&storage);
+        in->sin_family = AF_INET;
+        in->sin_port = htons(static_cast<std::uint16_t>(std::strtoul(address, nullptr, 10)));
+        in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return sizeof(sockaddr_in);
+    }
+    sockaddr_un* un = reinterpret_cast<sockaddr_un*>(&storage);
+    if (std::strlen(address) >= sizeof(un->sun_path)) return 0;
+    un->sun_family = AF_UNIX;
+    std::strcpy(un->sun_path, address);
+    return sizeof(sockaddr_un);
+}
+
+
+class GameServer {
+private:
+    // One cache line per session; free slots are chained through nextFree
+    struct Session {
+        std::uint64_t target;
+        std::uint64_t startedNs;    // when the current game started
+        std::uint64_t lastActiveNs; // last byte received, for idle eviction
+        std::int32_t fd;
+        std::uint32_t attempts;
+        std::uint32_t nextFree;
+        std::uint8_t inLen;
+        char inBuf[27]; // partial request line
+    };
+    static_assert(sizeof(Session) == 64, "Session should fill exactly one cache line");
+
+    static const std::uint32_t NO_SESSION = UINT32_MAX;
+    static const std::uint64_t LISTENER = UINT64_MAX;
+    static const std::uint64_t IDLE_TIMEOUT_NS = 60ULL * 1000000000ULL;
+    // Longest single reply: "READY <20 digits> <20 digits>\n" is 48 bytes
+    static const std::size_t MAX_REPLY = 64;
+
+    std::vector<Session> sessions;
+    std::uint32_t freeHead;
+    std::uint32_t active;
+    int listenFd;
+    int epollFd;
+    std::string path; // Unix socket to unlink on exit
+    bool tcp;
+    std::uint64_t low;
+    std::uint64_t high;
+    FastRandom rng;
+    std::uint64_t sessionsServed;
+    std::uint64_t gamesWon;
+
+    void newGame(Session& session, std::uint64_t now) {
+        session.target = rng.between(low, high);
+        session.attempts = 0;
+        session.startedNs = now;
+    }
+
+    void closeSession(std::uint32_t index) {
+        Session& session = sessions[index];
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, session.fd, nullptr);
+        close(session.fd);
+        session.fd = -1;
+        session.nextFree = freeHead;
+        freeHead = index;
+        active--;
+    }
+
+    void acceptAll() {
+        for (;;) {
+            int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) return; // EAGAIN: backlog drained
+
+            if (freeHead == NO_SESSION) {
+                send(fd, "BUSY\n", 5, MSG_NOSIGNAL);
+                close(fd);
+                continue;
+            }
+            std::uint32_t index = freeHead;
+            Session& session = sessions[index];
+            freeHead = session.nextFree;
+            active++;
+            sessionsServed++;
+
+            std::uint64_t now = nowNanos();
+            session.fd = fd;
+            session.inLen = 0;
+            session.lastActiveNs = now;
+            newGame(session, now);
+            if (tcp) {
+                int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            }
+
+            epoll_event event;
+            event.events = EPOLLIN;
+            event.data.u64 = index;
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+
+            char reply[64];
+            int len = std::snprintf(reply, sizeof(reply), "READY %llu %llu\n",
+                                    static_cast<unsigned long long>(low), static_cast<unsigned long long>(high));
+            send(fd, reply, static_cast<std::size_t>(len), MSG_NOSIGNAL);
+        }
+    }
+
+    // Appends the reply for one request line to 'out', which has at least
+    // MAX_REPLY bytes of room
+    char* handleLine(Session& session, const char* line, std::size_t len, char* out, std::uint64_t now) {
+        if (len == 3 && std::memcmp(line, "NEW", 3) == 0) {
+            newGame(session, now);
+            return out + std::snprintf(out, MAX_REPLY, "READY %llu %llu\n", static_cast<unsigned long long>(low),
+                                       static_cast<unsigned long long>(high));
+        }
+
+        std::uint64_t guess;
+        std::from_chars_result parsed = std::from_chars(line, line + len, guess);
+        if (parsed.ec != std::errc() || parsed.ptr != line + len) {
+            std::memcpy(out, "ERROR\n", 6);
+            return out + 6;
+        }
+
+        session.attempts++;
+        if (guess < session.target) {
+            std::memcpy(out, "LOW\n", 4);
+            return out + 4;
+        }
+        if (guess > session.target) {
+            std::memcpy(out, "HIGH\n", 5);
+            return out + 5;
+        }
+        char* end = out + std::snprintf(out, MAX_REPLY, "CORRECT %u\n", session.attempts);
+        gamesWon++;
+        newGame(session, now);
+        return end;
+    }
+
+    // Clients wait for each reply, so a short write means one that stopped reading
+    bool sendReplies(const Session& session, const char* replies, std::size_t pending) {
+        return pending == 0 || send(session.fd, replies, pending, MSG_NOSIGNAL) == static_cast<ssize_t>(pending);
+    }
+
+    void handleRead(std::uint32_t index) {
+        Session& session = sessions[index];
+        char input[4096];
+        char replies[4096 * 2];
+        std::uint64_t now = nowNanos();
+
+        for (;;) {
+            ssize_t got = recv(session.fd, input, sizeof(input), 0);
+            if (got == 0 || (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+                closeSession(index);
+                return;
+            }
+            if (got < 0) return;
+            session.lastActiveNs = now;
+
+            // Even an empty line gets a reply, so replies can outgrow the input;
+            // flush whenever there may not be room for one more
+            char* out = replies;
+            for (ssize_t i = 0; i < got; i++) {
+                char ch = input[i];
+                if (ch == '\n') {
+                    if (static_cast<std::size_t>(replies + sizeof(replies) - out) < MAX_REPLY) {
+                        if (!sendReplies(session, replies, static_cast<std::size_t>(out - replies))) {
+                            closeSession(index);
+                            return;
+                        }
+                        out = replies;
+                    }
+                    std::size_t len = session.inLen;
+                    if (len > 0 && session.inBuf[len - 1] == '\r') len--;
+                    out = handleLine(session, session.inBuf, len, out, now);
+                    session.inLen = 0;
+                } else if (session.inLen < sizeof(session.inBuf)) {
+                    session.inBuf[session.inLen++] = ch;
+                } else {
+                    closeSession(index); // line too long for any valid request
+                    return;
+                }
+            }
+
+            if (!sendReplies(session, replies, static_cast<std::size_t>(out - replies))) {
+                closeSession(index);
+                return;
+            }
+        }
+    }
+
+    void evictIdle(std::uint64_t now) {
+        for (std::uint32_t i = 0; i < sessions.size(); i++) {
+            if (sessions[i].fd >= 0 && now - sessions[i].lastActiveNs > IDLE_TIMEOUT_NS) {
+                closeSession(i);
+            }
+        }
+    }
+
+public:
+    GameServer(std::uint64_t low, std::uint64_t high, std::uint32_t capacity)
+        : sessions(capacity), freeHead(capacity > 0 ? 0 : NO_SESSION), active(0), listenFd(-1), epollFd(-1),
+          tcp(false), low(low), high(high), rng(nowNanos()), sessionsServed(0), gamesWon(0) {
+        for (std::uint32_t i = 0; i < capacity; i++) {
+            sessions[i].fd = -1;
+            sessions[i].nextFree = (i + 1 < capacity) ? i + 1 : NO_SESSION;
+        }
+    }
+
+    ~GameServer() {
+        for (std::uint32_t i = 0; i < sessions.size(); i++) {
+            if (sessions[i].fd >= 0) close(sessions[i].fd);
+        }
+        if (listenFd >= 0) close(listenFd);
+        if (epollFd >= 0) close(epollFd);
+        if (!path.empty()) unlink(path.c_str());
+    }
+
+    bool listenOn(const char* address) {
+        sockaddr_storage storage;
+        socklen_t length = makeAddress(address, storage);
+        if (length == 0) {
+            std::cerr << "Error: Socket path too long!" << std::endl;
+            return false;
+        }
+
+        listenFd = socket(storage.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        int one = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (storage.ss_family == AF_UNIX) {
+            unlink(address);
+        }
+        if (listenFd < 0 || bind(listenFd, reinterpret_cast<sockaddr*>(&storage), length) != 0 ||
+            listen(listenFd, SOMAXCONN) != 0) {
+            std::cerr << "Error: Could not listen on '" << address << "': " << std::strerror(errno) << std::endl;
+            return false;
+        }
+        if (storage.ss_family == AF_UNIX) {
+            path = address;
+        }
+        tcp = storage.ss_family == AF_INET;
+
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u64 = LISTENER;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+        return true;
+    }
+
+    void run() {
+        const int MAX_EVENTS = 256;
+        epoll_event events[MAX_EVENTS];
+        std::uint64_t lastSweep = nowNanos();
+
+        while (!stopRequested) {
+            int ready = epoll_wait(epollFd, events, MAX_EVENTS, 1000);
+            bool pendingAccept = false;
+            for (int i = 0; i < ready; i++) {
+                if (events[i].data.u64 == LISTENER) {
+                    pendingAccept = true;
+                } else if (sessions[events[i].data.u64].fd >= 0) {
+                    handleRead(static_cast<std::uint32_t>(events[i].data.u64));
+                }
+            }
+            // Accept after the reads so sessions closed in this batch free their slots first
+            if (pendingAccept) {
+                acceptAll();
+            }
+
+            std::uint64_t now = nowNanos();
+            if (now - lastSweep > 1000000000ULL) {
+                evictIdle(now);
+                lastSweep = now;
+            }
+        }
+        std::cout << "Sessions served: " << sessionsServed << ", games won: " << gamesWon
+                  << ", still connected: " << active << std::endl;
+    }
+};
+
+int runServer(const char* address, std::uint64_t low, std::uint64_t high, std::uint32_t capacity) {
+    if (low > high) {
+        std::cerr << "Error: Range low must not exceed high!" << std::endl;
+        return 1;
+    }
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    GameServer server(low, high, capacity);
+    if (!server.listenOn(address)) {
+        return 1;
+    }
+    std::cout << "Guessing game server on " << address << " (range " << low << "-" << high << ", up to "
+              << capacity << " sessions). Ctrl+C to stop." << std::endl;
+    server.run();
+    return 0;
+}
+
+// Load-test client: keeps 'concurrency' connections open, each playing one
+// binary-search game per session, until 'totalSessions' games are won.
+// Latency is measured per guess, from send to reply.
+int runClient(const char* address, std::uint64_t totalSessions, unsigned concurrency) {
+    struct Connection {
+        int fd = -1;
+        BinarySearchGuesser guesser;
+        std::uint64_t sentNs = 0;
+        std::size_t inLen = 0;
+        char inBuf[64];
+    };
+
+    std::signal(SIGPIPE, SIG_IGN);
+    if (concurrency == 0) concurrency = 1;
+    if (concurrency > totalSessions) concurrency = static_cast<unsigned>(std::max<std::uint64_t>(1, totalSessions));
+
+    sockaddr_storage storage;
+    socklen_t length = makeAddress(address, storage);
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    std::vector<Connection> connections(concurrency);
+    std::vector<std::uint64_t> latencies;
+    std::uint64_t started = 0, completed = 0, failed = 0;
+
+    auto open = [&](std::uint32_t index) -> bool {
+        Connection& conn = connections[index];
+        conn.fd = socket(storage.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (conn.fd < 0 || connect(conn.fd, reinterpret_cast<sockaddr*>(&storage), length) != 0) {
+            if (conn.fd >= 0) close(conn.fd);
+            conn.fd = -1;
+            return false;
+        }
+        if (storage.ss_family == AF_INET) {
+            int one = 1;
+            setsockopt(conn.fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+        fcntl(conn.fd, F_SETFL, fcntl(conn.fd, F_GETFL) | O_NONBLOCK);
+        conn.inLen = 0;
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u32 = index;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, conn.fd, &event);
+        started++;
+        return true;
+    };
+
+    auto sendGuess = [&](Connection& conn) {
+        char line[32];
+        int len = std::snprintf(line, sizeof(line), "%llu\n", static_cast<unsigned long long>(conn.guesser.guess()));
+        conn.sentNs = nowNanos();
+        send(conn.fd, line, static_cast<std::size_t>(len), MSG_NOSIGNAL);
+    };
+
+    // Closes a finished or broken connection and starts the next session on its slot
+    auto finish = [&](std::uint32_t index) {
+        Connection& conn = connections[index];
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, conn.fd, nullptr);
+        close(conn.fd);
+        conn.fd = -1;
+        while (started < totalSessions && failed < totalSessions && !open(index)) failed++;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0; i < concurrency; i++) {
+        if (!open(i)) {
+            std::cerr << "Error: Could not connect to '" << address << "': " << std::strerror(errno) << std::endl;
+            return 1;
+        }
+    }
+
+    epoll_event events[256];
+    while (completed + failed < started || started < totalSessions) {
+        int ready = epoll_wait(epollFd, events, 256, 5000);
+        if (ready <= 0) {
+            std::cerr << "Error: Server stopped responding!" << std::endl;
+            break;
+        }
+        for (int e = 0; e < ready; e++) {
+            std::uint32_t index = events[e].data.u32;
+            Connection& conn = connections[index];
+            if (conn.fd < 0) continue;
+
+            char input[512];
+            ssize_t got = recv(conn.fd, input, sizeof(input), 0);
+            if (got <= 0) {
+                if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) continue;
+                failed++;
+                finish(index);
+                continue;
+            }
+
+            for (ssize_t i = 0; i < got && conn.fd >= 0; i++) {
+                if (input[i] != '\n') {
+                    if (conn.inLen < sizeof(conn.inBuf) - 1) conn.inBuf[conn.inLen++] = input[i];
+                    continue;
+                }
+                conn.inBuf[conn.inLen] = '\0';
+                conn.inLen = 0;
+
+                if (std::strncmp(conn.inBuf, "READY ", 6) == 0) {
+                    char* rest = nullptr;
+                    std::uint64_t low = std::strtoull(conn.inBuf + 6, &rest, 10);
+                    std::uint64_t high = std::strtoull(rest, nullptr, 10);
+                    conn.guesser.reset(low, high);
+                    sendGuess(conn);
+                    continue;
+                }
+
+                if (std::strcmp(conn.inBuf, "BUSY") == 0) { // server's session table is full
+                    failed++;
+                    finish(index);
+                    continue;
+                }
+
+                latencies.push_back(nowNanos() - conn.sentNs);
+                if (std::strcmp(conn.inBuf, "LOW") == 0) {
+                    conn.guesser.feedback(Feedback::TooLow);
+                    sendGuess(conn);
+                } else if (std::strcmp(conn.inBuf, "HIGH") == 0) {
+                    conn.guesser.feedback(Feedback::TooHigh);
+                    sendGuess(conn);
+                } else {
+                    if (std::strncmp(conn.inBuf, "CORRECT", 7) == 0) completed++;
+                    else failed++;
+                    finish(index);
+                }
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (Connection& conn : connections) {
+        if (conn.fd >= 0) close(conn.fd);
+    }
+    close(epollFd);
+
+    std::cout << "Sessions: " << completed << " completed, " << failed << " failed, " << concurrency
+              << " concurrent" << std::endl;
+    std::cout << "Sessions/s: " << completed / seconds << ", guesses/s: " << latencies.size() / seconds << std::endl;
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) {
+            return static_cast<double>(latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]) / 1000.0;
+        };
+        std::cout << "Latency (us): p50 " << percentile(0.50) << ", p99 " << percentile(0.99) << ", max "
+                  << percentile(1.0) << std::endl;
+    }
+    return failed == 0 ? 0 : 1;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    // task2-level1 --simulate <binary|random|interpolation> [games] [low] [high] [threads]
+    if (argc > 2 && std::strcmp(argv[1], "--simulate") == 0) {
+        std::uint64_t games = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 1000000;
+        std::uint64_t low = (argc > 4) ? std::strtoull(argv[4], nullptr, 10) : 1;
+        std::uint64_t high = (argc > 5) ? std::strtoull(argv[5], nullptr, 10) : UINT64_MAX;
+        unsigned threads = (argc > 6) ? static_cast<unsigned>(std::strtoul(argv[6], nullptr, 10))
+                                      : std::thread::hardware_concurrency();
+        return runSimulation(argv[2], games, low, high, threads);
+    }
+
+    // task2-level1 --server <port|socket-path> [low] [high] [max-sessions]
+    // task2-level1 --client <port|socket-path> [sessions] [concurrency]
+    if (argc > 2 && (std::strcmp(argv[1], "--server") == 0 || std::strcmp(argv[1], "--client") == 0)) {
+#ifdef __linux__
+        if (std::strcmp(argv[1], "--server") == 0) {
+            std::uint64_t low = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 1;
+            std::uint64_t high = (argc > 4) ? std::strtoull(argv[4], nullptr, 10) : 100;
+            std::uint32_t capacity = (argc > 5) ? static_cast<std::uint32_t>(std::strtoul(argv[5], nullptr, 10)) : 65536;
+            return runServer(argv[2], low, high, capacity);
+        }
+        std::uint64_t sessions = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 100000;
+        unsigned concurrency = (argc > 4) ? static_cast<unsigned>(std::strtoul(argv[4], nullptr, 10)) : 1000;
+        return runClient(argv[2], sessions, concurrency);
+#else
+        std::cerr << "Error: Server and client modes need Linux (epoll)." << std::endl;
+        return 1;
+#endif
+    }
 
-int main() {
     std::srand(static_cast<unsigned int>(std::time(nullptr)));
     int numberToGuess = std::rand() % 100 + 1; // The number to guess (1-100)
     int userGuess = 0; // Variable to store the user's guess
@@ -22,10 +611,10 @@ int main() {
         } else if (userGuess > numberToGuess) {
             std::cout << "Too high! Try again." << std::endl;
         } else {
-            std::cout << "Congratulations! You've guessed the number " << numberToGuess 
+            std::cout << "Congratulations! You've guessed the number " << numberToGuess
                       << " in " << attempts << " attempts." << std::endl;
         }
     }
 
     return 0;
-}
\ No newline at end of file
+}
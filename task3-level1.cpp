@@ -1,71 +1,472 @@
 ///String Manipulation
 #include <iostream>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
 using std::cout;
 using std::endl;
 
-char* reverseString(char* str) {
-    if (str == nullptr) return nullptr;
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-    char* start = str;
-    char* end = str;
+#include "string_utils.h"
 
-    // Move 'end' to the last character of the string
-    while (*end != '\0') {
-        end++;
-    }
-    end--; // Set 'end' to the last valid character
+// Throughput benchmark: scalar vs. dispatched kernels on sizes from 16 B up to maxBytes
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void runBenchmark(std::size_t maxBytes) {
+    const std::size_t bytesPerRun = std::size_t(1) << 28; // ~256 MB processed per measurement
+
+    cout << "Dispatched kernels: " << stringKernels().name << endl;
+    cout << "size_bytes,kernel,reverse_gbps,vowels_gbps,palindrome_gbps" << endl;
 
-    // Swap characters from start and end until they meet in the middle
-    while (start < end) {
-        char temp = *start;
-        *start = *end;
-        *end = temp;
-        start++;
-        end--;
+    std::vector<char> data(maxBytes);
+    std::srand(12345);
+    volatile std::size_t sink = 0;
+
+    // Sizes step by 4x, and maxBytes itself is always the last one measured
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = 16; size < maxBytes; size *= 4) sizes.push_back(size);
+    sizes.push_back(maxBytes);
+
+    for (std::size_t size : sizes) {
+        // Palindromic input so the compare walks the whole buffer
+        for (std::size_t i = 0; i < size / 2; i++) {
+            char ch = static_cast<char>('A' + std::rand() % 58);
+            data[i] = ch;
+            data[size - 1 - i] = ch;
+        }
+        std::size_t reps = bytesPerRun / size;
+        if (reps == 0) reps = 1;
+        double gigabytes = static_cast<double>(size) * static_cast<double>(reps) / 1e9;
+
+        const StringKernels* variants[] = {&scalarStringKernels(), &stringKernels()};
+        for (const StringKernels* k : variants) {
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t r = 0; r < reps; r++) k->reverse(data.data(), size);
+            double reverseGbps = gigabytes / secondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            for (std::size_t r = 0; r < reps; r++) sink = sink + k->countVowels(data.data(), size);
+            double vowelsGbps = gigabytes / secondsSince(start);
+
+            start = std::chrono::steady_clock::now();
+            for (std::size_t r = 0; r < reps; r++) sink = sink + k->mirrorEqual(data.data(), data.data() + size, size / 2);
+            double palindromeGbps = gigabytes / secondsSince(start);
+
+            cout << size << "," << k->name << "," << reverseGbps << "," << vowelsGbps << ","
+                 << palindromeGbps << endl;
+        }
     }
+}
 
-    return str;
+// Call-overhead benchmark: NUL-terminated API (strlen + kernel) vs. the
+// length-aware overloads, on strings where the extra scan is a visible cost
+static void runApiBenchmark() {
+    const std::size_t bytesPerRun = std::size_t(1) << 26;
+
+    cout << "size_bytes,vowels_cstr_ns,vowels_view_ns,palindrome_cstr_ns,palindrome_view_ns" << endl;
+
+    volatile std::size_t sink = 0;
+    for (std::size_t size = 8; size <= 65536; size *= 4) {
+        std::vector<char> buffer(size + 1, 'a');
+        buffer[size] = '\0';
+        const char* cstr = buffer.data();
+        std::string_view view(cstr, size);
+        std::size_t reps = bytesPerRun / size;
+        double scale = 1e9 / static_cast<double>(reps);
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; r++) sink = sink + countingVowels(cstr);
+        double vowelsCstr = secondsSince(start) * scale;
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; r++) sink = sink + countingVowels(view);
+        double vowelsView = secondsSince(start) * scale;
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; r++) sink = sink + isPalindrome(cstr);
+        double palindromeCstr = secondsSince(start) * scale;
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; r++) sink = sink + isPalindrome(view);
+        double palindromeView = secondsSince(start) * scale;
+
+        cout << size << "," << vowelsCstr << "," << vowelsView << "," << palindromeCstr << ","
+             << palindromeView << endl;
+    }
 }
 
-int countingVowels(const char* str) {
-    if (str == nullptr) return 0;
+// Read-only view of a whole file. On POSIX systems the file is mmap'ed so
+// the kernels run straight over the page cache; elsewhere it is read in.
+class MappedFile {
+private:
+    const char* mapped;
+    std::size_t length;
+    std::vector<char> fallback;
+
+public:
+    MappedFile() : mapped(nullptr), length(0) {}
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (mapped != nullptr && fallback.empty()) {
+            munmap(const_cast<char*>(mapped), length);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
 
-    int count = 0;
-    while (*str != '\0') {
-        char ch = *str;
-        if (ch == 'a' || ch == 'e' || ch == 'i' || ch == 'o' || ch == 'u' ||
-            ch == 'A' || ch == 'E' || ch == 'I' || ch == 'O' || ch == 'U') {
-            count++;
+    bool open(const char* path) {
+#ifndef _WIN32
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "Error: Could not open '" << path << "'!" << endl;
+            return false;
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            std::cerr << "Error: Could not stat '" << path << "'!" << endl;
+            close(fd);
+            return false;
+        }
+        length = static_cast<std::size_t>(info.st_size);
+        if (length > 0) {
+            void* addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                std::cerr << "Error: Could not map '" << path << "'!" << endl;
+                close(fd);
+                return false;
+            }
+            madvise(addr, length, MADV_SEQUENTIAL);
+            mapped = static_cast<const char*>(addr);
+        }
+        close(fd);
+        return true;
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            std::cerr << "Error: Could not open '" << path << "'!" << endl;
+            return false;
         }
-        str++;
+        in.seekg(0, std::ios::end);
+        length = static_cast<std::size_t>(in.tellg());
+        in.seekg(0, std::ios::beg);
+        fallback.resize(length);
+        in.read(fallback.data(), static_cast<std::streamsize>(length));
+        mapped = fallback.data();
+        return true;
+#endif
+    }
+
+    const char* data() const { return mapped; }
+    std::size_t size() const { return length; }
+};
+
+// Parallel kernels over one large buffer: each thread owns a contiguous slice
+static std::size_t countVowelsParallel(const char* data, std::size_t len, unsigned threadCount) {
+    std::vector<std::size_t> partial(threadCount, 0);
+    std::vector<std::thread> workers;
+    std::size_t slice = len / threadCount;
+
+    for (unsigned t = 0; t < threadCount; t++) {
+        std::size_t begin = t * slice;
+        std::size_t end = (t + 1 == threadCount) ? len : begin + slice;
+        workers.emplace_back([&partial, data, begin, end, t]() {
+            partial[t] = stringKernels().countVowels(data + begin, end - begin);
+        });
+    }
+
+    std::size_t total = 0;
+    for (unsigned t = 0; t < threadCount; t++) {
+        workers[t].join();
+        total += partial[t];
     }
-    return count;
+    return total;
 }
 
-bool isPalindrome(const char* str) {
-    if (str == nullptr) return false;
+// Each thread compares one chunk of the first half against its mirror in the
+// second half; the shared flag lets the others stop early on a mismatch.
+static bool isPalindromeParallel(const char* data, std::size_t len, unsigned threadCount) {
+    const std::size_t step = std::size_t(1) << 20; // re-check the flag every 1 MB
+    std::size_t half = len / 2;
+    std::size_t slice = half / threadCount;
+    std::atomic<bool> mismatch(false);
+    std::vector<std::thread> workers;
 
-    const char* start = str;
-    const char* end = str;
+    for (unsigned t = 0; t < threadCount; t++) {
+        std::size_t begin = t * slice;
+        std::size_t end = (t + 1 == threadCount) ? half : begin + slice;
+        workers.emplace_back([&mismatch, data, len, begin, end, step]() {
+            for (std::size_t pos = begin; pos < end && !mismatch.load(std::memory_order_relaxed); pos += step) {
+                std::size_t n = std::min(step, end - pos);
+                if (!stringKernels().mirrorEqual(data + pos, data + len - pos, n)) {
+                    mismatch.store(true, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
 
-    // Move 'end' to the last character of the string
-    while (*end != '\0') {
-        end++;
+    for (std::thread& worker : workers) {
+        worker.join();
     }
-    end--; // Set 'end' to the last valid character
+    return !mismatch.load();
+}
+
+// Reads a chunk at 'offset' through 'in', failing on a short read
+static bool readChunk(std::ifstream& in, std::size_t offset, char* buffer, std::size_t len) {
+    in.seekg(static_cast<std::streamoff>(offset));
+    in.read(buffer, static_cast<std::streamsize>(len));
+    return static_cast<std::size_t>(in.gcount()) == len;
+}
+
+// ifstream baseline in fixed-size chunks, so memory stays flat however large
+// the file is: each step reads a chunk from the front and its mirror from the
+// back, which covers every byte once for the vowel count
+static bool readMirroredChunks(const char* path, std::size_t size, std::size_t& vowels, bool& palindrome) {
+    const std::size_t CHUNK = std::size_t(1) << 20;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::vector<char> front(CHUNK);
+    std::vector<char> back(CHUNK);
 
-    // Compare characters from start and end until they meet in the middle
-    while (start < end) {
-        if (*start != *end) {
+    std::size_t half = size / 2;
+    for (std::size_t pos = 0; pos < half; pos += CHUNK) {
+        std::size_t len = std::min(CHUNK, half - pos);
+        if (!readChunk(in, pos, front.data(), len) || !readChunk(in, size - pos - len, back.data(), len)) {
             return false;
         }
-        start++;
-        end--;
+        vowels += countVowelsScalar(front.data(), len) + countVowelsScalar(back.data(), len);
+        palindrome = palindrome && mirrorEqualScalar(front.data(), back.data() + len, len);
+    }
+    if (size % 2 == 1) {
+        if (!readChunk(in, half, front.data(), 1)) return false;
+        vowels += countVowelsScalar(front.data(), 1);
     }
+    return true;
+}
+
+// Large-file mode: mapped + parallel kernels vs. reading through ifstream
+static bool runFileMode(const char* path, unsigned threadCount) {
+    if (threadCount == 0) threadCount = 1;
 
+    auto start = std::chrono::steady_clock::now();
+    MappedFile file;
+    if (!file.open(path)) {
+        return false;
+    }
+    std::size_t vowels = countVowelsParallel(file.data(), file.size(), threadCount);
+    bool palindrome = isPalindromeParallel(file.data(), file.size(), threadCount);
+    double mappedSeconds = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    std::size_t streamVowels = 0;
+    bool streamPalindrome = true;
+    if (!readMirroredChunks(path, file.size(), streamVowels, streamPalindrome)) {
+        std::cerr << "Error: could not read file through ifstream: " << path << endl;
+        return false;
+    }
+    double streamSeconds = secondsSince(start);
+
+    double gigabytes = static_cast<double>(file.size()) / 1e9;
+    cout << "File: " << path << " (" << file.size() << " bytes)" << endl;
+    cout << "Number of vowels: " << vowels << endl;
+    cout << "Is palindrome: " << (palindrome ? "true" : "false") << endl;
+    cout << "mmap + " << threadCount << " threads (" << stringKernels().name << "): " << mappedSeconds << " s, "
+         << gigabytes / mappedSeconds << " GB/s" << endl;
+    cout << "ifstream + scalar:          " << streamSeconds << " s, " << gigabytes / streamSeconds << " GB/s" << endl;
+
+    if (streamVowels != vowels || streamPalindrome != palindrome) {
+        std::cerr << "Error: ifstream and mapped results differ!" << endl;
+        return false;
+    }
     return true;
 }
-int main() {
+
+// Batch mode: one record per line. Results go into arrays sized up front and
+// indexed by line number; binary output is one LineResult per line.
+struct LineResult {
+    std::uint32_t vowels;
+    std::uint32_t palindrome;
+};
+
+// Byte range of one worker's lines; blocks always end just after a '\n'
+struct LineBlock {
+    std::size_t begin;
+    std::size_t end;
+    std::size_t firstLine;
+};
+
+static std::size_t countLines(const char* data, std::size_t begin, std::size_t end) {
+    std::size_t lines = 0;
+    const char* pos = data + begin;
+    const char* stop = data + end;
+    while (pos < stop) {
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(stop - pos)));
+        lines++;
+        if (newline == nullptr) break;
+        pos = newline + 1;
+    }
+    return lines;
+}
+
+static void processLines(const char* data, const LineBlock& block, LineResult* results) {
+    const char* pos = data + block.begin;
+    const char* stop = data + block.end;
+    LineResult* out = results + block.firstLine;
+    const StringKernels& kernels = stringKernels();
+
+    while (pos < stop) {
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(stop - pos)));
+        const char* lineEnd = (newline != nullptr) ? newline : stop;
+        std::size_t len = static_cast<std::size_t>(lineEnd - pos);
+        if (len > 0 && pos[len - 1] == '\r') len--;
+
+        out->vowels = static_cast<std::uint32_t>(kernels.countVowels(pos, len));
+        out->palindrome = kernels.mirrorEqual(pos, pos + len, len / 2);
+        out++;
+
+        if (newline == nullptr) break;
+        pos = newline + 1;
+    }
+}
+
+static bool writeCsv(std::FILE* output, const std::vector<LineResult>& results) {
+    const std::size_t flushAt = std::size_t(1) << 20;
+    std::vector<char> buffer(flushAt + 64);
+    std::size_t used = 0;
+
+    for (std::size_t line = 0; line < results.size(); line++) {
+        char* pos = buffer.data() + used;
+        char* end = buffer.data() + buffer.size();
+        pos = std::to_chars(pos, end, line + 1).ptr;
+        *pos++ = ',';
+        pos = std::to_chars(pos, end, results[line].vowels).ptr;
+        *pos++ = ',';
+        *pos++ = results[line].palindrome ? '1' : '0';
+        *pos++ = '\n';
+        used = static_cast<std::size_t>(pos - buffer.data());
+
+        if (used >= flushAt) {
+            if (std::fwrite(buffer.data(), 1, used, output) != used) return false;
+            used = 0;
+        }
+    }
+    return std::fwrite(buffer.data(), 1, used, output) == used;
+}
+
+static bool runLineMode(const char* path, bool binary, const char* outputPath, unsigned threadCount) {
+    if (threadCount == 0) threadCount = 1;
+
+    MappedFile file;
+    if (!file.open(path)) {
+        return false;
+    }
+    const char* data = file.data();
+    std::size_t len = file.size();
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Split into one block per thread, moving each cut forward past the next newline
+    std::vector<LineBlock> blocks;
+    std::size_t begin = 0;
+    for (unsigned t = 0; t < threadCount && begin < len; t++) {
+        std::size_t end = (t + 1 == threadCount) ? len : std::max(begin, len / threadCount * (t + 1));
+        if (end < len) {
+            const char* newline = static_cast<const char*>(std::memchr(data + end, '\n', len - end));
+            end = (newline != nullptr) ? static_cast<std::size_t>(newline - data) + 1 : len;
+        }
+        blocks.push_back({begin, end, 0});
+        begin = end;
+    }
+
+    // First pass counts lines per block so every worker knows where its results go
+    std::vector<std::thread> workers;
+    for (LineBlock& block : blocks) {
+        workers.emplace_back([data, &block]() { block.firstLine = countLines(data, block.begin, block.end); });
+    }
+    for (std::thread& worker : workers) worker.join();
+    workers.clear();
+
+    std::size_t totalLines = 0;
+    for (LineBlock& block : blocks) {
+        std::size_t lines = block.firstLine;
+        block.firstLine = totalLines;
+        totalLines += lines;
+    }
+
+    std::vector<LineResult> results(totalLines);
+    for (const LineBlock& block : blocks) {
+        workers.emplace_back([data, &block, &results]() { processLines(data, block, results.data()); });
+    }
+    for (std::thread& worker : workers) worker.join();
+    double processSeconds = secondsSince(start);
+
+    std::FILE* output = (std::strcmp(outputPath, "-") == 0) ? stdout : std::fopen(outputPath, "wb");
+    if (output == nullptr) {
+        std::cerr << "Error: Could not open '" << outputPath << "' for writing!" << endl;
+        return false;
+    }
+    bool written = binary ? std::fwrite(results.data(), sizeof(LineResult), results.size(), output) == results.size()
+                          : writeCsv(output, results);
+    written = (output == stdout ? std::fflush(output) : std::fclose(output)) == 0 && written;
+    double totalSeconds = secondsSince(start);
+
+    if (!written) {
+        std::cerr << "Error: Could not write results!" << endl;
+        return false;
+    }
+    std::cerr << "Records: " << totalLines << " (" << blocks.size() << " threads, " << stringKernels().name << ")" << endl;
+    std::cerr << "Processing: " << totalLines / processSeconds << " records/s" << endl;
+    std::cerr << "Including output: " << totalLines / totalSeconds << " records/s" << endl;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) {
+        std::size_t maxBytes = std::size_t(1) << 30; // 1 GB
+        if (argc > 2) maxBytes = std::strtoull(argv[2], nullptr, 10);
+        if (maxBytes < 16) maxBytes = 16;
+        runBenchmark(maxBytes);
+        return 0;
+    }
+    if (argc > 1 && std::strcmp(argv[1], "--bench-api") == 0) {
+        runApiBenchmark();
+        return 0;
+    }
+    if (argc > 2 && std::strcmp(argv[1], "--file") == 0) {
+        unsigned threadCount = std::thread::hardware_concurrency();
+        if (argc > 3) threadCount = static_cast<unsigned>(std::strtoul(argv[3], nullptr, 10));
+        return runFileMode(argv[2], threadCount) ? 0 : 1;
+    }
+    if (argc > 2 && std::strcmp(argv[1], "--lines") == 0) {
+        bool binary = argc > 3 && std::strcmp(argv[3], "bin") == 0;
+        const char* outputPath = (argc > 4) ? argv[4] : "-";
+        unsigned threadCount = std::thread::hardware_concurrency();
+        if (argc > 5) threadCount = static_cast<unsigned>(std::strtoul(argv[5], nullptr, 10));
+        return runLineMode(argv[2], binary, outputPath, threadCount) ? 0 : 1;
+    }
+
     char str1[] = "Hello, World!";
     cout << "Original String: " << str1 << endl;
     cout << "Reversed String: " << reverseString(str1) << endl;
@@ -79,5 +480,19 @@ int main() {
     const char* str4 = "hello";
     cout << "\"" << str4 << "\" is palindrome: " << (isPalindrome(str4) ? "true" : "false") << endl;
 
+    char str5[] = "Ça va, señor?";
+    cout << "Original UTF-8 String: " << str5 << endl;
+    cout << "Reversed UTF-8 String: " << reverseStringUtf8(str5) << endl;
+
+    const char* str6 = "Canción del árbol";
+    cout << "Number of vowels in \"" << str6 << "\": " << countingVowelsUtf8(str6, VowelSet("aeiouáéíóú")) << endl;
+
+    const char* str7 = "А роза упала на лапу Азора";
+    PalindromeOptions loose;
+    loose.foldCase = true;
+    loose.skipPunctuation = true;
+    cout << "\"" << str7 << "\" is palindrome (ignoring case and spaces): "
+         << (isPalindromeUtf8(str7, loose) ? "true" : "false") << endl;
+
     return 0;
-}
\ No newline at end of file
+}
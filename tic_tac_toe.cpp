@@ -0,0 +1,84 @@
+// Tic-Tac-Toe core: board setup, move validation and win/draw checks
+#include "tic_tac_toe.h"
+#include <iostream>
+#include "metrics.h"
+using namespace std;
+
+METRICS_HISTOGRAM(moveLatency, "tic_tac_toe.move");
+METRICS_COUNTER(movesMade, "tic_tac_toe.moves");
+METRICS_COUNTER(movesRejected, "tic_tac_toe.moves_rejected");
+
+// Initialize the game board with empty spaces
+void initializeBoard(char board[BOARD_SIZE][BOARD_SIZE]) {
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            board[i][j] = EMPTY;
+        }
+    }
+}
+
+// Make a move on the board
+bool makeMove(char board[BOARD_SIZE][BOARD_SIZE], int row, int col, char player) {
+    METRICS_TIME(moveLatency);
+
+    // Validate input
+    if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE) {
+        METRICS_INC(movesRejected);
+        cout << "Error: Invalid position! Row and column must be 1-3." << endl;
+        return false;
+    }
+    
+    // Check if position is already occupied
+    if (board[row][col] != EMPTY) {
+        METRICS_INC(movesRejected);
+        cout << "Error: Position already occupied! Choose another spot." << endl;
+        return false;
+    }
+    
+    // Place the move
+    board[row][col] = player;
+    METRICS_INC(movesMade);
+    return true;
+}
+
+// Check if a player has won (a full row, column or diagonal). Not timed: the
+// check is cheaper than reading the clock.
+bool checkWin(const char board[BOARD_SIZE][BOARD_SIZE], char player) {
+    // Check rows
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        if (board[i][0] == player && board[i][1] == player && board[i][2] == player) {
+            return true;
+        }
+    }
+    
+    // Check columns
+    for (int j = 0; j < BOARD_SIZE; j++) {
+        if (board[0][j] == player && board[1][j] == player && board[2][j] == player) {
+            return true;
+        }
+    }
+    
+    // Check diagonal (top-left to bottom-right)
+    if (board[0][0] == player && board[1][1] == player && board[2][2] == player) {
+        return true;
+    }
+    
+    // Check diagonal (top-right to bottom-left)
+    if (board[0][2] == player && board[1][1] == player && board[2][0] == player) {
+        return true;
+    }
+    
+    return false;
+}
+
+// Check if the game is a draw
+bool checkDraw(const char board[BOARD_SIZE][BOARD_SIZE]) {
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            if (board[i][j] == EMPTY) {
+                return false; // Found an empty space, not a draw
+            }
+        }
+    }
+    return true; // No empty spaces and no winner = draw
+}
@@ -0,0 +1,23 @@
+// Tic-Tac-Toe core: board setup, move validation and win/draw checks. Every
+// function works on the board it is given, so several games can run at once.
+#ifndef TIC_TAC_TOE_H
+#define TIC_TAC_TOE_H
+
+const int BOARD_SIZE = 3;
+const char PLAYER_X = 'X';
+const char PLAYER_O = 'O';
+const char EMPTY = ' ';
+
+// Initialize the game board with empty spaces
+void initializeBoard(char board[BOARD_SIZE][BOARD_SIZE]);
+
+// Make a move on the board; prints why and returns false if it isn't allowed
+bool makeMove(char board[BOARD_SIZE][BOARD_SIZE], int row, int col, char player);
+
+// Check if a player has won
+bool checkWin(const char board[BOARD_SIZE][BOARD_SIZE], char player);
+
+// Check if the game is a draw (no empty spaces left)
+bool checkDraw(const char board[BOARD_SIZE][BOARD_SIZE]);
+
+#endif